@@ -0,0 +1,109 @@
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "MADworld" for configuration ""
+set_property(TARGET MADworld APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(MADworld PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "C;CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libMADworld.a"
+  )
+
+list(APPEND _cmake_import_check_targets MADworld )
+list(APPEND _cmake_import_check_files_for_MADworld "${_IMPORT_PREFIX}/lib/libMADworld.a" )
+
+# Import target "MADmuparser" for configuration ""
+set_property(TARGET MADmuparser APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(MADmuparser PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libMADmuparser.a"
+  )
+
+list(APPEND _cmake_import_check_targets MADmuparser )
+list(APPEND _cmake_import_check_files_for_MADmuparser "${_IMPORT_PREFIX}/lib/libMADmuparser.a" )
+
+# Import target "MADtinyxml" for configuration ""
+set_property(TARGET MADtinyxml APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(MADtinyxml PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libMADtinyxml.a"
+  )
+
+list(APPEND _cmake_import_check_targets MADtinyxml )
+list(APPEND _cmake_import_check_files_for_MADtinyxml "${_IMPORT_PREFIX}/lib/libMADtinyxml.a" )
+
+# Import target "MADmisc" for configuration ""
+set_property(TARGET MADmisc APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(MADmisc PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libMADmisc.a"
+  )
+
+list(APPEND _cmake_import_check_targets MADmisc )
+list(APPEND _cmake_import_check_files_for_MADmisc "${_IMPORT_PREFIX}/lib/libMADmisc.a" )
+
+# Import target "MADgit" for configuration ""
+set_property(TARGET MADgit APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(MADgit PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libMADgit.a"
+  )
+
+list(APPEND _cmake_import_check_targets MADgit )
+list(APPEND _cmake_import_check_files_for_MADgit "${_IMPORT_PREFIX}/lib/libMADgit.a" )
+
+# Import target "MADtensor" for configuration ""
+set_property(TARGET MADtensor APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(MADtensor PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libMADtensor.a"
+  )
+
+list(APPEND _cmake_import_check_targets MADtensor )
+list(APPEND _cmake_import_check_files_for_MADtensor "${_IMPORT_PREFIX}/lib/libMADtensor.a" )
+
+# Import target "MADlinalg" for configuration ""
+set_property(TARGET MADlinalg APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(MADlinalg PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libMADlinalg.a"
+  )
+
+list(APPEND _cmake_import_check_targets MADlinalg )
+list(APPEND _cmake_import_check_files_for_MADlinalg "${_IMPORT_PREFIX}/lib/libMADlinalg.a" )
+
+# Import target "MADmra" for configuration ""
+set_property(TARGET MADmra APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(MADmra PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libMADmra.a"
+  )
+
+list(APPEND _cmake_import_check_targets MADmra )
+list(APPEND _cmake_import_check_files_for_MADmra "${_IMPORT_PREFIX}/lib/libMADmra.a" )
+
+# Import target "madness" for configuration ""
+set_property(TARGET madness APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(madness PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "C;CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libmadness.a"
+  )
+
+list(APPEND _cmake_import_check_targets madness )
+list(APPEND _cmake_import_check_files_for_madness "${_IMPORT_PREFIX}/lib/libmadness.a" )
+
+# Import target "MADchem" for configuration ""
+set_property(TARGET MADchem APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(MADchem PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libMADchem.a"
+  )
+
+list(APPEND _cmake_import_check_targets MADchem )
+list(APPEND _cmake_import_check_files_for_MADchem "${_IMPORT_PREFIX}/lib/libMADchem.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/numerical-examples"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/numerical-examples.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
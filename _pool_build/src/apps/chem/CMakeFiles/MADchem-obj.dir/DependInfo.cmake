@@ -0,0 +1,58 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/apps/chem/AC.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/AC.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/AC.cc.o.d"
+  "/root/repo/src/apps/chem/CC2.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/CC2.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/CC2.cc.o.d"
+  "/root/repo/src/apps/chem/CCPotentials.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/CCPotentials.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/CCPotentials.cc.o.d"
+  "/root/repo/src/apps/chem/CCStructures.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/CCStructures.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/CCStructures.cc.o.d"
+  "/root/repo/src/apps/chem/GuessFactory.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/GuessFactory.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/GuessFactory.cc.o.d"
+  "/root/repo/src/apps/chem/MolecularOrbitals.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/MolecularOrbitals.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/MolecularOrbitals.cc.o.d"
+  "/root/repo/src/apps/chem/NWChem.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/NWChem.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/NWChem.cc.o.d"
+  "/root/repo/src/apps/chem/PNO.cpp" "src/apps/chem/CMakeFiles/MADchem-obj.dir/PNO.cpp.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/PNO.cpp.o.d"
+  "/root/repo/src/apps/chem/PNOF12Potentials.cpp" "src/apps/chem/CMakeFiles/MADchem-obj.dir/PNOF12Potentials.cpp.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/PNOF12Potentials.cpp.o.d"
+  "/root/repo/src/apps/chem/PNOGuessFunctions.cpp" "src/apps/chem/CMakeFiles/MADchem-obj.dir/PNOGuessFunctions.cpp.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/PNOGuessFunctions.cpp.o.d"
+  "/root/repo/src/apps/chem/PNOParameters.cpp" "src/apps/chem/CMakeFiles/MADchem-obj.dir/PNOParameters.cpp.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/PNOParameters.cpp.o.d"
+  "/root/repo/src/apps/chem/PNOStructures.cpp" "src/apps/chem/CMakeFiles/MADchem-obj.dir/PNOStructures.cpp.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/PNOStructures.cpp.o.d"
+  "/root/repo/src/apps/chem/QCCalculationParametersBase.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/QCCalculationParametersBase.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/QCCalculationParametersBase.cc.o.d"
+  "/root/repo/src/apps/chem/SCF.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/SCF.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/SCF.cc.o.d"
+  "/root/repo/src/apps/chem/SCFOperators.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/SCFOperators.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/SCFOperators.cc.o.d"
+  "/root/repo/src/apps/chem/TDHF.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/TDHF.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/TDHF.cc.o.d"
+  "/root/repo/src/apps/chem/atomutil.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/atomutil.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/atomutil.cc.o.d"
+  "/root/repo/src/apps/chem/benchmark_exchange_operator.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/benchmark_exchange_operator.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/benchmark_exchange_operator.cc.o.d"
+  "/root/repo/src/apps/chem/corepotential.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/corepotential.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/corepotential.cc.o.d"
+  "/root/repo/src/apps/chem/correlationfactor.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/correlationfactor.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/correlationfactor.cc.o.d"
+  "/root/repo/src/apps/chem/diamagneticpotentialfactor.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/diamagneticpotentialfactor.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/diamagneticpotentialfactor.cc.o.d"
+  "/root/repo/src/apps/chem/distpm.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/distpm.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/distpm.cc.o.d"
+  "/root/repo/src/apps/chem/exchangeoperator.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/exchangeoperator.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/exchangeoperator.cc.o.d"
+  "/root/repo/src/apps/chem/gaussian.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/gaussian.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/gaussian.cc.o.d"
+  "/root/repo/src/apps/chem/gth_pseudopotential.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/gth_pseudopotential.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/gth_pseudopotential.cc.o.d"
+  "/root/repo/src/apps/chem/lda.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/lda.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/lda.cc.o.d"
+  "/root/repo/src/apps/chem/localizer.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/localizer.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/localizer.cc.o.d"
+  "/root/repo/src/apps/chem/molecularbasis.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/molecularbasis.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/molecularbasis.cc.o.d"
+  "/root/repo/src/apps/chem/molecule.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/molecule.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/molecule.cc.o.d"
+  "/root/repo/src/apps/chem/mp2.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/mp2.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/mp2.cc.o.d"
+  "/root/repo/src/apps/chem/nemo.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/nemo.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/nemo.cc.o.d"
+  "/root/repo/src/apps/chem/oep.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/oep.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/oep.cc.o.d"
+  "/root/repo/src/apps/chem/pcm.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/pcm.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/pcm.cc.o.d"
+  "/root/repo/src/apps/chem/plotxc.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/plotxc.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/plotxc.cc.o.d"
+  "/root/repo/src/apps/chem/pointgroupsymmetry.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/pointgroupsymmetry.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/pointgroupsymmetry.cc.o.d"
+  "/root/repo/src/apps/chem/polynomial.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/polynomial.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/polynomial.cc.o.d"
+  "/root/repo/src/apps/chem/vibanal.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/vibanal.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/vibanal.cc.o.d"
+  "/root/repo/src/apps/chem/xcfunctional_ldaonly.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/xcfunctional_ldaonly.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/xcfunctional_ldaonly.cc.o.d"
+  "/root/repo/src/apps/chem/zcis.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/zcis.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/zcis.cc.o.d"
+  "/root/repo/src/apps/chem/znemo.cc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/znemo.cc.o" "gcc" "src/apps/chem/CMakeFiles/MADchem-obj.dir/znemo.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,87 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MADchem-obj.dir/AC.cc.o"
+  "CMakeFiles/MADchem-obj.dir/AC.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/CC2.cc.o"
+  "CMakeFiles/MADchem-obj.dir/CC2.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/CCPotentials.cc.o"
+  "CMakeFiles/MADchem-obj.dir/CCPotentials.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/CCStructures.cc.o"
+  "CMakeFiles/MADchem-obj.dir/CCStructures.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/GuessFactory.cc.o"
+  "CMakeFiles/MADchem-obj.dir/GuessFactory.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/MolecularOrbitals.cc.o"
+  "CMakeFiles/MADchem-obj.dir/MolecularOrbitals.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/NWChem.cc.o"
+  "CMakeFiles/MADchem-obj.dir/NWChem.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/PNO.cpp.o"
+  "CMakeFiles/MADchem-obj.dir/PNO.cpp.o.d"
+  "CMakeFiles/MADchem-obj.dir/PNOF12Potentials.cpp.o"
+  "CMakeFiles/MADchem-obj.dir/PNOF12Potentials.cpp.o.d"
+  "CMakeFiles/MADchem-obj.dir/PNOGuessFunctions.cpp.o"
+  "CMakeFiles/MADchem-obj.dir/PNOGuessFunctions.cpp.o.d"
+  "CMakeFiles/MADchem-obj.dir/PNOParameters.cpp.o"
+  "CMakeFiles/MADchem-obj.dir/PNOParameters.cpp.o.d"
+  "CMakeFiles/MADchem-obj.dir/PNOStructures.cpp.o"
+  "CMakeFiles/MADchem-obj.dir/PNOStructures.cpp.o.d"
+  "CMakeFiles/MADchem-obj.dir/QCCalculationParametersBase.cc.o"
+  "CMakeFiles/MADchem-obj.dir/QCCalculationParametersBase.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/SCF.cc.o"
+  "CMakeFiles/MADchem-obj.dir/SCF.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/SCFOperators.cc.o"
+  "CMakeFiles/MADchem-obj.dir/SCFOperators.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/TDHF.cc.o"
+  "CMakeFiles/MADchem-obj.dir/TDHF.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/atomutil.cc.o"
+  "CMakeFiles/MADchem-obj.dir/atomutil.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/benchmark_exchange_operator.cc.o"
+  "CMakeFiles/MADchem-obj.dir/benchmark_exchange_operator.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/corepotential.cc.o"
+  "CMakeFiles/MADchem-obj.dir/corepotential.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/correlationfactor.cc.o"
+  "CMakeFiles/MADchem-obj.dir/correlationfactor.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/diamagneticpotentialfactor.cc.o"
+  "CMakeFiles/MADchem-obj.dir/diamagneticpotentialfactor.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/distpm.cc.o"
+  "CMakeFiles/MADchem-obj.dir/distpm.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/exchangeoperator.cc.o"
+  "CMakeFiles/MADchem-obj.dir/exchangeoperator.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/gaussian.cc.o"
+  "CMakeFiles/MADchem-obj.dir/gaussian.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/gth_pseudopotential.cc.o"
+  "CMakeFiles/MADchem-obj.dir/gth_pseudopotential.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/lda.cc.o"
+  "CMakeFiles/MADchem-obj.dir/lda.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/localizer.cc.o"
+  "CMakeFiles/MADchem-obj.dir/localizer.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/molecularbasis.cc.o"
+  "CMakeFiles/MADchem-obj.dir/molecularbasis.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/molecule.cc.o"
+  "CMakeFiles/MADchem-obj.dir/molecule.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/mp2.cc.o"
+  "CMakeFiles/MADchem-obj.dir/mp2.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/nemo.cc.o"
+  "CMakeFiles/MADchem-obj.dir/nemo.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/oep.cc.o"
+  "CMakeFiles/MADchem-obj.dir/oep.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/pcm.cc.o"
+  "CMakeFiles/MADchem-obj.dir/pcm.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/plotxc.cc.o"
+  "CMakeFiles/MADchem-obj.dir/plotxc.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/pointgroupsymmetry.cc.o"
+  "CMakeFiles/MADchem-obj.dir/pointgroupsymmetry.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/polynomial.cc.o"
+  "CMakeFiles/MADchem-obj.dir/polynomial.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/vibanal.cc.o"
+  "CMakeFiles/MADchem-obj.dir/vibanal.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/xcfunctional_ldaonly.cc.o"
+  "CMakeFiles/MADchem-obj.dir/xcfunctional_ldaonly.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/zcis.cc.o"
+  "CMakeFiles/MADchem-obj.dir/zcis.cc.o.d"
+  "CMakeFiles/MADchem-obj.dir/znemo.cc.o"
+  "CMakeFiles/MADchem-obj.dir/znemo.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MADchem-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/apps/chem/benchmark_exchange_operator.cc" "src/apps/chem/CMakeFiles/benchmark_exchange_operator.dir/benchmark_exchange_operator.cc.o" "gcc" "src/apps/chem/CMakeFiles/benchmark_exchange_operator.dir/benchmark_exchange_operator.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_pool_build/src/apps/chem/CMakeFiles/MADchem.dir/DependInfo.cmake"
+  "/root/repo/_pool_build/src/madness/misc/CMakeFiles/MADgit.dir/DependInfo.cmake"
+  "/root/repo/_pool_build/src/madness/mra/CMakeFiles/MADmra.dir/DependInfo.cmake"
+  "/root/repo/_pool_build/src/madness/tensor/CMakeFiles/MADlinalg.dir/DependInfo.cmake"
+  "/root/repo/_pool_build/src/madness/tensor/CMakeFiles/MADtensor.dir/DependInfo.cmake"
+  "/root/repo/_pool_build/src/madness/misc/CMakeFiles/MADmisc.dir/DependInfo.cmake"
+  "/root/repo/_pool_build/src/madness/external/tinyxml/CMakeFiles/MADtinyxml.dir/DependInfo.cmake"
+  "/root/repo/_pool_build/src/madness/external/muParser/CMakeFiles/MADmuparser.dir/DependInfo.cmake"
+  "/root/repo/_pool_build/src/madness/world/CMakeFiles/MADworld.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
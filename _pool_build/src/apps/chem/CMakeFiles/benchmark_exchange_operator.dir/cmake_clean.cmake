@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_exchange_operator.dir/benchmark_exchange_operator.cc.o"
+  "CMakeFiles/benchmark_exchange_operator.dir/benchmark_exchange_operator.cc.o.d"
+  "benchmark_exchange_operator"
+  "benchmark_exchange_operator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_exchange_operator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
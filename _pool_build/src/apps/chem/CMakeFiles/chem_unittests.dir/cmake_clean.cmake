@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/chem_unittests"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/chem_unittests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/install-madness-chem"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/install-madness-chem.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/plotxc.dir/plotxc.cc.o"
+  "CMakeFiles/plotxc.dir/plotxc.cc.o.d"
+  "plotxc"
+  "plotxc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/plotxc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
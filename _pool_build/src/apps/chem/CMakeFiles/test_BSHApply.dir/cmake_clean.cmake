@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_BSHApply.dir/test_BSHApply.cc.o"
+  "CMakeFiles/test_BSHApply.dir/test_BSHApply.cc.o.d"
+  "test_BSHApply"
+  "test_BSHApply.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_BSHApply.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_MolecularOrbitals.dir/test_MolecularOrbitals.cc.o"
+  "CMakeFiles/test_MolecularOrbitals.dir/test_MolecularOrbitals.cc.o.d"
+  "test_MolecularOrbitals"
+  "test_MolecularOrbitals.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_MolecularOrbitals.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_QCCalculationParametersBase.dir/test_QCCalculationParametersBase.cc.o"
+  "CMakeFiles/test_QCCalculationParametersBase.dir/test_QCCalculationParametersBase.cc.o.d"
+  "test_QCCalculationParametersBase"
+  "test_QCCalculationParametersBase.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_QCCalculationParametersBase.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
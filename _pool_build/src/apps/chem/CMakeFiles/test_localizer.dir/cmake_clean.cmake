@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_localizer.dir/test_localizer.cc.o"
+  "CMakeFiles/test_localizer.dir/test_localizer.cc.o.d"
+  "test_localizer"
+  "test_localizer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_localizer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
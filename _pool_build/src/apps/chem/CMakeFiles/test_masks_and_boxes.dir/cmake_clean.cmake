@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_masks_and_boxes.dir/test_masks_and_boxes.cc.o"
+  "CMakeFiles/test_masks_and_boxes.dir/test_masks_and_boxes.cc.o.d"
+  "test_masks_and_boxes"
+  "test_masks_and_boxes.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_masks_and_boxes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
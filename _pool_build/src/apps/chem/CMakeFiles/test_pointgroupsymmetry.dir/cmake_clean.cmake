@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_pointgroupsymmetry.dir/test_pointgroupsymmetry.cc.o"
+  "CMakeFiles/test_pointgroupsymmetry.dir/test_pointgroupsymmetry.cc.o.d"
+  "test_pointgroupsymmetry"
+  "test_pointgroupsymmetry.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_pointgroupsymmetry.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
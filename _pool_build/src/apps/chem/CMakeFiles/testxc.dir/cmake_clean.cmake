@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testxc.dir/testxc.cc.o"
+  "CMakeFiles/testxc.dir/testxc.cc.o.d"
+  "testxc"
+  "testxc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testxc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
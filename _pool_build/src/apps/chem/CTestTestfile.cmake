@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/apps/chem
+# Build directory: /root/repo/_pool_build/src/apps/chem
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(madness/test/chem/build "/usr/bin/cmake" "--build" "/root/repo/_pool_build" "--target" "chem_unittests-madness")
+set_tests_properties(madness/test/chem/build PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;8;add_test;/root/repo/src/apps/chem/CMakeLists.txt;145;add_unittests;/root/repo/src/apps/chem/CMakeLists.txt;0;")
+add_test(madness/test/chem/test_pointgroupsymmetry/run "/root/repo/_pool_build/src/apps/chem/test_pointgroupsymmetry")
+set_tests_properties(madness/test/chem/test_pointgroupsymmetry/run PROPERTIES  DEPENDS "madness/test/chem/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/apps/chem/CMakeLists.txt;145;add_unittests;/root/repo/src/apps/chem/CMakeLists.txt;0;")
+add_test(madness/test/chem/test_masks_and_boxes/run "/root/repo/_pool_build/src/apps/chem/test_masks_and_boxes")
+set_tests_properties(madness/test/chem/test_masks_and_boxes/run PROPERTIES  DEPENDS "madness/test/chem/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/apps/chem/CMakeLists.txt;145;add_unittests;/root/repo/src/apps/chem/CMakeLists.txt;0;")
+add_test(madness/test/chem/test_localizer/run "/root/repo/_pool_build/src/apps/chem/test_localizer")
+set_tests_properties(madness/test/chem/test_localizer/run PROPERTIES  DEPENDS "madness/test/chem/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/apps/chem/CMakeLists.txt;145;add_unittests;/root/repo/src/apps/chem/CMakeLists.txt;0;")
+add_test(madness/test/chem/test_QCCalculationParametersBase/run "/root/repo/_pool_build/src/apps/chem/test_QCCalculationParametersBase")
+set_tests_properties(madness/test/chem/test_QCCalculationParametersBase/run PROPERTIES  DEPENDS "madness/test/chem/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/apps/chem/CMakeLists.txt;145;add_unittests;/root/repo/src/apps/chem/CMakeLists.txt;0;")
+add_test(madness/test/chem/test_qc/run "/root/repo/_pool_build/src/apps/chem/test_qc")
+set_tests_properties(madness/test/chem/test_qc/run PROPERTIES  DEPENDS "madness/test/chem/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/apps/chem/CMakeLists.txt;145;add_unittests;/root/repo/src/apps/chem/CMakeLists.txt;0;")
+add_test(madness/test/chem/test_MolecularOrbitals/run "/root/repo/_pool_build/src/apps/chem/test_MolecularOrbitals")
+set_tests_properties(madness/test/chem/test_MolecularOrbitals/run PROPERTIES  DEPENDS "madness/test/chem/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/apps/chem/CMakeLists.txt;145;add_unittests;/root/repo/src/apps/chem/CMakeLists.txt;0;")
+add_test(madness/test/chem/test_BSHApply/run "/root/repo/_pool_build/src/apps/chem/test_BSHApply")
+set_tests_properties(madness/test/chem/test_BSHApply/run PROPERTIES  DEPENDS "madness/test/chem/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/apps/chem/CMakeLists.txt;145;add_unittests;/root/repo/src/apps/chem/CMakeLists.txt;0;")
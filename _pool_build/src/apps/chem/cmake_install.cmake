@@ -0,0 +1,116 @@
+# Install script for directory: /root/repo/src/apps/chem
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "chem" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/_pool_build/src/apps/chem/libMADchem.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "chem" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/chem" TYPE FILE FILES
+    "/root/repo/src/apps/chem/AC.h"
+    "/root/repo/src/apps/chem/atomutil.h"
+    "/root/repo/src/apps/chem/basis.h"
+    "/root/repo/src/apps/chem/BSHApply.h"
+    "/root/repo/src/apps/chem/CalculationParameters.h"
+    "/root/repo/src/apps/chem/CC2.h"
+    "/root/repo/src/apps/chem/CCPotentials.h"
+    "/root/repo/src/apps/chem/CCStructures.h"
+    "/root/repo/src/apps/chem/commandlineparser.h"
+    "/root/repo/src/apps/chem/corepotential.h"
+    "/root/repo/src/apps/chem/correlationfactor.h"
+    "/root/repo/src/apps/chem/diamagneticpotentialfactor.h"
+    "/root/repo/src/apps/chem/electronic_correlation_factor.h"
+    "/root/repo/src/apps/chem/ESInterface.h"
+    "/root/repo/src/apps/chem/exchangeoperator.h"
+    "/root/repo/src/apps/chem/gaussian.h"
+    "/root/repo/src/apps/chem/gth_pseudopotential.h"
+    "/root/repo/src/apps/chem/GuessFactory.h"
+    "/root/repo/src/apps/chem/localizer.h"
+    "/root/repo/src/apps/chem/masks_and_boxes.h"
+    "/root/repo/src/apps/chem/molecularbasis.h"
+    "/root/repo/src/apps/chem/molecular_optimizer.h"
+    "/root/repo/src/apps/chem/MolecularOrbitals.h"
+    "/root/repo/src/apps/chem/molecule.h"
+    "/root/repo/src/apps/chem/molopt.h"
+    "/root/repo/src/apps/chem/mp2.h"
+    "/root/repo/src/apps/chem/nemo.h"
+    "/root/repo/src/apps/chem/NWChem.h"
+    "/root/repo/src/apps/chem/oep.h"
+    "/root/repo/src/apps/chem/pcm.h"
+    "/root/repo/src/apps/chem/PNOF12Potentials.h"
+    "/root/repo/src/apps/chem/PNOGuessFunctions.h"
+    "/root/repo/src/apps/chem/PNO.h"
+    "/root/repo/src/apps/chem/PNOParameters.h"
+    "/root/repo/src/apps/chem/PNOStructures.h"
+    "/root/repo/src/apps/chem/PNOTensors.h"
+    "/root/repo/src/apps/chem/pointgroupoperator.h"
+    "/root/repo/src/apps/chem/pointgroupsymmetry.h"
+    "/root/repo/src/apps/chem/polynomial.h"
+    "/root/repo/src/apps/chem/potentialmanager.h"
+    "/root/repo/src/apps/chem/projector.h"
+    "/root/repo/src/apps/chem/QCCalculationParametersBase.h"
+    "/root/repo/src/apps/chem/SCF.h"
+    "/root/repo/src/apps/chem/SCFOperators.h"
+    "/root/repo/src/apps/chem/SCFProtocol.h"
+    "/root/repo/src/apps/chem/TDHF.h"
+    "/root/repo/src/apps/chem/test_correlation_factor.h"
+    "/root/repo/src/apps/chem/vibanal.h"
+    "/root/repo/src/apps/chem/write_test_input.h"
+    "/root/repo/src/apps/chem/xcfunctional.h"
+    "/root/repo/src/apps/chem/zcis.h"
+    "/root/repo/src/apps/chem/znemo.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "chem" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/share/madness/0.10.1/data" TYPE FILE FILES
+    "/root/repo/src/apps/chem/sto-3g"
+    "/root/repo/src/apps/chem/sto-6g"
+    "/root/repo/src/apps/chem/6-31g"
+    "/root/repo/src/apps/chem/coredata/mcp"
+    "/root/repo/src/apps/chem/coredata/mcp2"
+    "/root/repo/src/apps/chem/coredata/mcp_guess"
+    )
+endif()
+
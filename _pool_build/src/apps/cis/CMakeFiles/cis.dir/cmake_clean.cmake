@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cis.dir/cis.cpp.o"
+  "CMakeFiles/cis.dir/cis.cpp.o.d"
+  "cis"
+  "cis.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cis.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/moldft.dir/moldft.cc.o"
+  "CMakeFiles/moldft.dir/moldft.cc.o.d"
+  "moldft"
+  "moldft.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/moldft.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
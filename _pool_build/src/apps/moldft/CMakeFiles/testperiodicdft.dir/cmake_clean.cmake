@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testperiodicdft.dir/testperiodicdft.cc.o"
+  "CMakeFiles/testperiodicdft.dir/testperiodicdft.cc.o.d"
+  "testperiodicdft"
+  "testperiodicdft.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testperiodicdft.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "3dharmonic"
+  "3dharmonic.pdb"
+  "CMakeFiles/3dharmonic.dir/3dharmonic.cc.o"
+  "CMakeFiles/3dharmonic.dir/3dharmonic.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/3dharmonic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ac_corr.dir/ac_corr.cc.o"
+  "CMakeFiles/ac_corr.dir/ac_corr.cc.o.d"
+  "ac_corr"
+  "ac_corr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ac_corr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
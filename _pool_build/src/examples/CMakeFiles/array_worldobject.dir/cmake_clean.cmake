@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/array_worldobject.dir/array_worldobject.cc.o"
+  "CMakeFiles/array_worldobject.dir/array_worldobject.cc.o.d"
+  "array_worldobject"
+  "array_worldobject.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/array_worldobject.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/binaryop.dir/binaryop.cc.o"
+  "CMakeFiles/binaryop.dir/binaryop.cc.o.d"
+  "binaryop"
+  "binaryop.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/binaryop.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cc2.dir/cc2.cc.o"
+  "CMakeFiles/cc2.dir/cc2.cc.o.d"
+  "cc2"
+  "cc2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cc2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dataloadbal.dir/dataloadbal.cc.o"
+  "CMakeFiles/dataloadbal.dir/dataloadbal.cc.o.d"
+  "dataloadbal"
+  "dataloadbal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dataloadbal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/derivatives.dir/derivatives.cc.o"
+  "CMakeFiles/derivatives.dir/derivatives.cc.o.d"
+  "derivatives"
+  "derivatives.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/derivatives.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
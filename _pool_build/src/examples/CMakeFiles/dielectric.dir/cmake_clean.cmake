@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dielectric.dir/dielectric.cc.o"
+  "CMakeFiles/dielectric.dir/dielectric.cc.o.d"
+  "dielectric"
+  "dielectric.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dielectric.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dielectric_external_field.dir/dielectric_external_field.cc.o"
+  "CMakeFiles/dielectric_external_field.dir/dielectric_external_field.cc.o.d"
+  "dielectric_external_field"
+  "dielectric_external_field.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dielectric_external_field.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
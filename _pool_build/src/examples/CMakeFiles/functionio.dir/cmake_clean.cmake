@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/functionio.dir/functionio.cc.o"
+  "CMakeFiles/functionio.dir/functionio.cc.o.d"
+  "functionio"
+  "functionio.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/functionio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
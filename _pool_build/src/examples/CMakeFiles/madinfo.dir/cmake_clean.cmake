@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/madinfo.dir/madinfo.cc.o"
+  "CMakeFiles/madinfo.dir/madinfo.cc.o.d"
+  "madinfo"
+  "madinfo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/madinfo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/newsolver.dir/newsolver.cc.o"
+  "CMakeFiles/newsolver.dir/newsolver.cc.o.d"
+  "newsolver"
+  "newsolver.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/newsolver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
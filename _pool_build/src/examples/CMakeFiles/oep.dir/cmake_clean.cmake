@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/oep.dir/oep.cc.o"
+  "CMakeFiles/oep.dir/oep.cc.o.d"
+  "oep"
+  "oep.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/oep.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sdf_shape_tester.dir/sdf_shape_tester.cc.o"
+  "CMakeFiles/sdf_shape_tester.dir/sdf_shape_tester.cc.o.d"
+  "sdf_shape_tester"
+  "sdf_shape_tester.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sdf_shape_tester.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/siam_example.dir/siam_example.cc.o"
+  "CMakeFiles/siam_example.dir/siam_example.cc.o.d"
+  "siam_example"
+  "siam_example.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/siam_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
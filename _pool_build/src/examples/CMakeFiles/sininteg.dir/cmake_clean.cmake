@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sininteg.dir/sininteg.cc.o"
+  "CMakeFiles/sininteg.dir/sininteg.cc.o.d"
+  "sininteg"
+  "sininteg.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sininteg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
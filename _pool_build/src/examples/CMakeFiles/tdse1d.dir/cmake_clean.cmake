@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tdse1d.dir/tdse1d.cc.o"
+  "CMakeFiles/tdse1d.dir/tdse1d.cc.o.d"
+  "tdse1d"
+  "tdse1d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tdse1d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tdse_example.dir/tdse_example.cc.o"
+  "CMakeFiles/tdse_example.dir/tdse_example.cc.o.d"
+  "tdse_example"
+  "tdse_example.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tdse_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
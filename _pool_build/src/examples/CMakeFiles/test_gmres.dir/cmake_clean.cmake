@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_gmres.dir/test_gmres.cc.o"
+  "CMakeFiles/test_gmres.dir/test_gmres.cc.o.d"
+  "test_gmres"
+  "test_gmres.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_gmres.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
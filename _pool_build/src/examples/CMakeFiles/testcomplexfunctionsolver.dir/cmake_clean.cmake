@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testcomplexfunctionsolver.dir/testcomplexfunctionsolver.cc.o"
+  "CMakeFiles/testcomplexfunctionsolver.dir/testcomplexfunctionsolver.cc.o.d"
+  "testcomplexfunctionsolver"
+  "testcomplexfunctionsolver.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testcomplexfunctionsolver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
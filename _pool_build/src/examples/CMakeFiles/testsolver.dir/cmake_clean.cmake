@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testsolver.dir/testsolver.cc.o"
+  "CMakeFiles/testsolver.dir/testsolver.cc.o.d"
+  "testsolver"
+  "testsolver.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testsolver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
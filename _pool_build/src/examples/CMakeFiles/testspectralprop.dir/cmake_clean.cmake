@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testspectralprop.dir/testspectralprop.cc.o"
+  "CMakeFiles/testspectralprop.dir/testspectralprop.cc.o.d"
+  "testspectralprop"
+  "testspectralprop.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testspectralprop.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
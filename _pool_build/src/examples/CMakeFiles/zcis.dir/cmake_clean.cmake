@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zcis.dir/zcis.cc.o"
+  "CMakeFiles/zcis.dir/zcis.cc.o.d"
+  "zcis"
+  "zcis.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zcis.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/znemo.dir/znemo.cc.o"
+  "CMakeFiles/znemo.dir/znemo.cc.o.d"
+  "znemo"
+  "znemo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/znemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/install-madness-clapack"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/install-madness-clapack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libmadness.a"
+  "libmadness.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/madness.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,77 @@
+# Install script for directory: /root/repo/src/madness
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "clapack" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/madness/tensor" TYPE FILE FILES
+    "/root/repo/src/madness/tensor/cblas.h"
+    "/root/repo/src/madness/tensor/cblas_types.h"
+    "/root/repo/src/madness/tensor/clapack.h"
+    "/root/repo/src/madness/tensor/clapack_fortran.h"
+    "/root/repo/src/madness/tensor/lapacke_types.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "common" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/madness" TYPE FILE FILES
+    "/root/repo/src/madness/constants.h"
+    "/root/repo/src/madness/fortran_ctypes.h"
+    "/root/repo/src/madness/madness_config.h"
+    "/root/repo/_pool_build/src/madness/config.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "madness" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/_pool_build/src/madness/libmadness.a")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_pool_build/src/madness/world/cmake_install.cmake")
+  include("/root/repo/_pool_build/src/madness/external/cmake_install.cmake")
+  include("/root/repo/_pool_build/src/madness/misc/cmake_install.cmake")
+  include("/root/repo/_pool_build/src/madness/tensor/cmake_install.cmake")
+  include("/root/repo/_pool_build/src/madness/mra/cmake_install.cmake")
+
+endif()
+
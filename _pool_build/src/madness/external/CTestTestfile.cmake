@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/madness/external
+# Build directory: /root/repo/_pool_build/src/madness/external
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("gtest")
+subdirs("muParser")
+subdirs("tinyxml")
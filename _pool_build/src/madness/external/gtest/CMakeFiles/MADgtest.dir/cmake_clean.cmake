@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MADgtest.dir/gtest-all.cc.o"
+  "CMakeFiles/MADgtest.dir/gtest-all.cc.o.d"
+  "libMADgtest.a"
+  "libMADgtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MADgtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MADmuparser-obj.dir/muParser.cpp.o"
+  "CMakeFiles/MADmuparser-obj.dir/muParser.cpp.o.d"
+  "CMakeFiles/MADmuparser-obj.dir/muParserBase.cpp.o"
+  "CMakeFiles/MADmuparser-obj.dir/muParserBase.cpp.o.d"
+  "CMakeFiles/MADmuparser-obj.dir/muParserBytecode.cpp.o"
+  "CMakeFiles/MADmuparser-obj.dir/muParserBytecode.cpp.o.d"
+  "CMakeFiles/MADmuparser-obj.dir/muParserCallback.cpp.o"
+  "CMakeFiles/MADmuparser-obj.dir/muParserCallback.cpp.o.d"
+  "CMakeFiles/MADmuparser-obj.dir/muParserError.cpp.o"
+  "CMakeFiles/MADmuparser-obj.dir/muParserError.cpp.o.d"
+  "CMakeFiles/MADmuparser-obj.dir/muParserTokenReader.cpp.o"
+  "CMakeFiles/MADmuparser-obj.dir/muParserTokenReader.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MADmuparser-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libMADmuparser.a"
+  "libMADmuparser.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MADmuparser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
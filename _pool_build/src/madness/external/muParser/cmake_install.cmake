@@ -0,0 +1,66 @@
+# Install script for directory: /root/repo/src/madness/external/muParser
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "muparser" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/_pool_build/src/madness/external/muParser/libMADmuparser.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "muparser" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/madness/external/muParser" TYPE FILE FILES
+    "/root/repo/src/madness/external/muParser/muParserBase.h"
+    "/root/repo/src/madness/external/muParser/muParserBytecode.h"
+    "/root/repo/src/madness/external/muParser/muParserCallback.h"
+    "/root/repo/src/madness/external/muParser/muParserDef.h"
+    "/root/repo/src/madness/external/muParser/muParserDLL.h"
+    "/root/repo/src/madness/external/muParser/muParserError.h"
+    "/root/repo/src/madness/external/muParser/muParserFixes.h"
+    "/root/repo/src/madness/external/muParser/muParser.h"
+    "/root/repo/src/madness/external/muParser/muParserInt.h"
+    "/root/repo/src/madness/external/muParser/muParserStack.h"
+    "/root/repo/src/madness/external/muParser/muParserTest.h"
+    "/root/repo/src/madness/external/muParser/muParserToken.h"
+    "/root/repo/src/madness/external/muParser/muParserTokenReader.h"
+    )
+endif()
+
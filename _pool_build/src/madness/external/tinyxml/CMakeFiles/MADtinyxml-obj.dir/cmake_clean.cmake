@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MADtinyxml-obj.dir/tinystr.cc.o"
+  "CMakeFiles/MADtinyxml-obj.dir/tinystr.cc.o.d"
+  "CMakeFiles/MADtinyxml-obj.dir/tinyxml.cc.o"
+  "CMakeFiles/MADtinyxml-obj.dir/tinyxml.cc.o.d"
+  "CMakeFiles/MADtinyxml-obj.dir/tinyxmlerror.cc.o"
+  "CMakeFiles/MADtinyxml-obj.dir/tinyxmlerror.cc.o.d"
+  "CMakeFiles/MADtinyxml-obj.dir/tinyxmlparser.cc.o"
+  "CMakeFiles/MADtinyxml-obj.dir/tinyxmlparser.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MADtinyxml-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libMADtinyxml.a"
+  "libMADtinyxml.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MADtinyxml.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/madness/external/tinyxml
+# Build directory: /root/repo/_pool_build/src/madness/external/tinyxml
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
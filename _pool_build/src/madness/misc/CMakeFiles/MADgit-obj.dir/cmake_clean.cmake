@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MADgit-obj.dir/gitinfo.cc.o"
+  "CMakeFiles/MADgit-obj.dir/gitinfo.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MADgit-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libMADgit.a"
+  "libMADgit.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MADgit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MADmisc-obj.dir/cfft.cc.o"
+  "CMakeFiles/MADmisc-obj.dir/cfft.cc.o.d"
+  "CMakeFiles/MADmisc-obj.dir/checksum_file.cc.o"
+  "CMakeFiles/MADmisc-obj.dir/checksum_file.cc.o.d"
+  "CMakeFiles/MADmisc-obj.dir/gprofexit.cc.o"
+  "CMakeFiles/MADmisc-obj.dir/gprofexit.cc.o.d"
+  "CMakeFiles/MADmisc-obj.dir/position_stream.cc.o"
+  "CMakeFiles/MADmisc-obj.dir/position_stream.cc.o.d"
+  "CMakeFiles/MADmisc-obj.dir/ran.cc.o"
+  "CMakeFiles/MADmisc-obj.dir/ran.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MADmisc-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libMADmisc.a"
+  "libMADmisc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MADmisc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mgit-madness"
+  "SYMBOLIC"
+  "_git_version.h"
+  "git_version.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/mgit-madness.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/misc_unittests"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/misc_unittests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/madness/misc
+# Build directory: /root/repo/_pool_build/src/madness/misc
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(madness/test/misc/build "/usr/bin/cmake" "--build" "/root/repo/_pool_build" "--target" "misc_unittests-madness")
+set_tests_properties(madness/test/misc/build PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;8;add_test;/root/repo/src/madness/misc/CMakeLists.txt;36;add_unittests;/root/repo/src/madness/misc/CMakeLists.txt;0;")
+add_test(madness/test/misc/interp3/run "/root/repo/_pool_build/src/madness/misc/interp3")
+set_tests_properties(madness/test/misc/interp3/run PROPERTIES  DEPENDS "madness/test/misc/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/misc/CMakeLists.txt;36;add_unittests;/root/repo/src/madness/misc/CMakeLists.txt;0;")
@@ -0,0 +1 @@
+const char* MADNESS_GITREVISION="3c2dea77c9220377b90ecf906bcea06c9da2b6fd+";
\ No newline at end of file
@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/madness/mra/checkpoint.cc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/checkpoint.cc.o" "gcc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/checkpoint.cc.o.d"
+  "/root/repo/src/madness/mra/convolution_cache.cc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/convolution_cache.cc.o" "gcc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/convolution_cache.cc.o.d"
+  "/root/repo/src/madness/mra/legendre.cc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/legendre.cc.o" "gcc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/legendre.cc.o.d"
+  "/root/repo/src/madness/mra/mra1.cc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/mra1.cc.o" "gcc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/mra1.cc.o.d"
+  "/root/repo/src/madness/mra/mra2.cc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/mra2.cc.o" "gcc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/mra2.cc.o.d"
+  "/root/repo/src/madness/mra/mra3.cc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/mra3.cc.o" "gcc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/mra3.cc.o.d"
+  "/root/repo/src/madness/mra/mra4.cc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/mra4.cc.o" "gcc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/mra4.cc.o.d"
+  "/root/repo/src/madness/mra/mra5.cc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/mra5.cc.o" "gcc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/mra5.cc.o.d"
+  "/root/repo/src/madness/mra/mra6.cc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/mra6.cc.o" "gcc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/mra6.cc.o.d"
+  "/root/repo/src/madness/mra/qmprop.cc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/qmprop.cc.o" "gcc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/qmprop.cc.o.d"
+  "/root/repo/src/madness/mra/startup.cc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/startup.cc.o" "gcc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/startup.cc.o.d"
+  "/root/repo/src/madness/mra/twoscale.cc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/twoscale.cc.o" "gcc" "src/madness/mra/CMakeFiles/MADmra-obj.dir/twoscale.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
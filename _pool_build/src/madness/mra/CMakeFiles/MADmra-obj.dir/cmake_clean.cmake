@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MADmra-obj.dir/checkpoint.cc.o"
+  "CMakeFiles/MADmra-obj.dir/checkpoint.cc.o.d"
+  "CMakeFiles/MADmra-obj.dir/convolution_cache.cc.o"
+  "CMakeFiles/MADmra-obj.dir/convolution_cache.cc.o.d"
+  "CMakeFiles/MADmra-obj.dir/legendre.cc.o"
+  "CMakeFiles/MADmra-obj.dir/legendre.cc.o.d"
+  "CMakeFiles/MADmra-obj.dir/mra1.cc.o"
+  "CMakeFiles/MADmra-obj.dir/mra1.cc.o.d"
+  "CMakeFiles/MADmra-obj.dir/mra2.cc.o"
+  "CMakeFiles/MADmra-obj.dir/mra2.cc.o.d"
+  "CMakeFiles/MADmra-obj.dir/mra3.cc.o"
+  "CMakeFiles/MADmra-obj.dir/mra3.cc.o.d"
+  "CMakeFiles/MADmra-obj.dir/mra4.cc.o"
+  "CMakeFiles/MADmra-obj.dir/mra4.cc.o.d"
+  "CMakeFiles/MADmra-obj.dir/mra5.cc.o"
+  "CMakeFiles/MADmra-obj.dir/mra5.cc.o.d"
+  "CMakeFiles/MADmra-obj.dir/mra6.cc.o"
+  "CMakeFiles/MADmra-obj.dir/mra6.cc.o.d"
+  "CMakeFiles/MADmra-obj.dir/qmprop.cc.o"
+  "CMakeFiles/MADmra-obj.dir/qmprop.cc.o.d"
+  "CMakeFiles/MADmra-obj.dir/startup.cc.o"
+  "CMakeFiles/MADmra-obj.dir/startup.cc.o.d"
+  "CMakeFiles/MADmra-obj.dir/twoscale.cc.o"
+  "CMakeFiles/MADmra-obj.dir/twoscale.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MADmra-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
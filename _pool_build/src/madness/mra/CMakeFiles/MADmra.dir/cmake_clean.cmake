@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libMADmra.a"
+  "libMADmra.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MADmra.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_matrix_inner.dir/benchmark_matrix_inner.cc.o"
+  "CMakeFiles/benchmark_matrix_inner.dir/benchmark_matrix_inner.cc.o.d"
+  "benchmark_matrix_inner"
+  "benchmark_matrix_inner.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_matrix_inner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mra_unittests"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/mra_unittests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_macrotaskpartitioner.dir/test_macrotaskpartitioner.cc.o"
+  "CMakeFiles/test_macrotaskpartitioner.dir/test_macrotaskpartitioner.cc.o.d"
+  "test_macrotaskpartitioner"
+  "test_macrotaskpartitioner.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_macrotaskpartitioner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_vectormacrotask.dir/test_vectormacrotask.cc.o"
+  "CMakeFiles/test_vectormacrotask.dir/test_vectormacrotask.cc.o.d"
+  "test_vectormacrotask"
+  "test_vectormacrotask.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_vectormacrotask.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testbc.dir/testbc.cc.o"
+  "CMakeFiles/testbc.dir/testbc.cc.o.d"
+  "testbc"
+  "testbc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testbc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
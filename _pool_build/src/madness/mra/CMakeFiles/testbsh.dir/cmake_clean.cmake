@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testbsh.dir/testbsh.cc.o"
+  "CMakeFiles/testbsh.dir/testbsh.cc.o.d"
+  "testbsh"
+  "testbsh.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testbsh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testdiff2D.dir/testdiff2D.cc.o"
+  "CMakeFiles/testdiff2D.dir/testdiff2D.cc.o.d"
+  "testdiff2D"
+  "testdiff2D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testdiff2D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
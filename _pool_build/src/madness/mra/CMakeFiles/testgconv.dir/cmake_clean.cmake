@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testgconv.dir/testgconv.cc.o"
+  "CMakeFiles/testgconv.dir/testgconv.cc.o.d"
+  "testgconv"
+  "testgconv.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testgconv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
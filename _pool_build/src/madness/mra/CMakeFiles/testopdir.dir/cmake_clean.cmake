@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testopdir.dir/testopdir.cc.o"
+  "CMakeFiles/testopdir.dir/testopdir.cc.o.d"
+  "testopdir"
+  "testopdir.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testopdir.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
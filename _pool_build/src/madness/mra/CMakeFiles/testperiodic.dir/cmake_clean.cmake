@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testperiodic.dir/testperiodic.cc.o"
+  "CMakeFiles/testperiodic.dir/testperiodic.cc.o.d"
+  "testperiodic"
+  "testperiodic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testperiodic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testproj.dir/testproj.cc.o"
+  "CMakeFiles/testproj.dir/testproj.cc.o.d"
+  "testproj"
+  "testproj.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testproj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testsuite.dir/testsuite.cc.o"
+  "CMakeFiles/testsuite.dir/testsuite.cc.o.d"
+  "testsuite"
+  "testsuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testsuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
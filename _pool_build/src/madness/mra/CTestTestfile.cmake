@@ -0,0 +1,38 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/madness/mra
+# Build directory: /root/repo/_pool_build/src/madness/mra
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(madness/test/mra/build "/usr/bin/cmake" "--build" "/root/repo/_pool_build" "--target" "mra_unittests-madness")
+set_tests_properties(madness/test/mra/build PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;8;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(madness/test/mra/testbsh/run "/root/repo/_pool_build/src/madness/mra/testbsh")
+set_tests_properties(madness/test/mra/testbsh/run PROPERTIES  DEPENDS "madness/test/mra/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(madness/test/mra/testproj/run "/root/repo/_pool_build/src/madness/mra/testproj")
+set_tests_properties(madness/test/mra/testproj/run PROPERTIES  DEPENDS "madness/test/mra/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(madness/test/mra/testpdiff/run "/root/repo/_pool_build/src/madness/mra/testpdiff")
+set_tests_properties(madness/test/mra/testpdiff/run PROPERTIES  DEPENDS "madness/test/mra/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(madness/test/mra/testdiff1Db/run "/root/repo/_pool_build/src/madness/mra/testdiff1Db")
+set_tests_properties(madness/test/mra/testdiff1Db/run PROPERTIES  DEPENDS "madness/test/mra/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(madness/test/mra/testgconv/run "/root/repo/_pool_build/src/madness/mra/testgconv")
+set_tests_properties(madness/test/mra/testgconv/run PROPERTIES  DEPENDS "madness/test/mra/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(madness/test/mra/testopdir/run "/root/repo/_pool_build/src/madness/mra/testopdir")
+set_tests_properties(madness/test/mra/testopdir/run PROPERTIES  DEPENDS "madness/test/mra/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(madness/test/mra/testinnerext/run "/root/repo/_pool_build/src/madness/mra/testinnerext")
+set_tests_properties(madness/test/mra/testinnerext/run PROPERTIES  DEPENDS "madness/test/mra/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(madness/test/mra/testgaxpyext/run "/root/repo/_pool_build/src/madness/mra/testgaxpyext")
+set_tests_properties(madness/test/mra/testgaxpyext/run PROPERTIES  DEPENDS "madness/test/mra/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(madness/test/mra/testvmra/run "/root/repo/_pool_build/src/madness/mra/testvmra")
+set_tests_properties(madness/test/mra/testvmra/run PROPERTIES  DEPENDS "madness/test/mra/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(madness/test/mra/test_vectormacrotask/run "/root/repo/_pool_build/src/madness/mra/test_vectormacrotask")
+set_tests_properties(madness/test/mra/test_vectormacrotask/run PROPERTIES  DEPENDS "madness/test/mra/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(madness/test/mra/test_cloud/run "/root/repo/_pool_build/src/madness/mra/test_cloud")
+set_tests_properties(madness/test/mra/test_cloud/run PROPERTIES  DEPENDS "madness/test/mra/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(madness/test/mra/test_macrotaskpartitioner/run "/root/repo/_pool_build/src/madness/mra/test_macrotaskpartitioner")
+set_tests_properties(madness/test/mra/test_macrotaskpartitioner/run PROPERTIES  DEPENDS "madness/test/mra/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/mra/CMakeLists.txt;41;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(madness/test/mra_sepop/build "/usr/bin/cmake" "--build" "/root/repo/_pool_build" "--target" "mra_sepop_unittests-madness")
+set_tests_properties(madness/test/mra_sepop/build PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;8;add_test;/root/repo/src/madness/mra/CMakeLists.txt;44;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(madness/test/mra_sepop/testsuite/run "/root/repo/_pool_build/src/madness/mra/testsuite")
+set_tests_properties(madness/test/mra_sepop/testsuite/run PROPERTIES  DEPENDS "madness/test/mra_sepop/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/mra/CMakeLists.txt;44;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
+add_test(madness/test/mra_sepop/testper/run "/root/repo/_pool_build/src/madness/mra/testper")
+set_tests_properties(madness/test/mra_sepop/testper/run PROPERTIES  DEPENDS "madness/test/mra_sepop/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/mra/CMakeLists.txt;44;add_unittests;/root/repo/src/madness/mra/CMakeLists.txt;0;")
@@ -0,0 +1,95 @@
+# Install script for directory: /root/repo/src/madness/mra
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "mra" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/_pool_build/src/madness/mra/libMADmra.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "mra" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/madness/mra" TYPE FILE FILES
+    "/root/repo/src/madness/mra/adquad.h"
+    "/root/repo/src/madness/mra/funcimpl.h"
+    "/root/repo/src/madness/mra/indexit.h"
+    "/root/repo/src/madness/mra/legendre.h"
+    "/root/repo/src/madness/mra/operator.h"
+    "/root/repo/src/madness/mra/vmra.h"
+    "/root/repo/src/madness/mra/funcdefaults.h"
+    "/root/repo/src/madness/mra/key.h"
+    "/root/repo/src/madness/mra/mra.h"
+    "/root/repo/src/madness/mra/power.h"
+    "/root/repo/src/madness/mra/qmprop.h"
+    "/root/repo/src/madness/mra/twoscale.h"
+    "/root/repo/src/madness/mra/lbdeux.h"
+    "/root/repo/src/madness/mra/mraimpl.h"
+    "/root/repo/src/madness/mra/funcplot.h"
+    "/root/repo/src/madness/mra/function_common_data.h"
+    "/root/repo/src/madness/mra/function_factory.h"
+    "/root/repo/src/madness/mra/function_interface.h"
+    "/root/repo/src/madness/mra/gfit.h"
+    "/root/repo/src/madness/mra/convolution1d.h"
+    "/root/repo/src/madness/mra/simplecache.h"
+    "/root/repo/src/madness/mra/derivative.h"
+    "/root/repo/src/madness/mra/displacements.h"
+    "/root/repo/src/madness/mra/functypedefs.h"
+    "/root/repo/src/madness/mra/sdf_shape_3D.h"
+    "/root/repo/src/madness/mra/sdf_domainmask.h"
+    "/root/repo/src/madness/mra/vmra1.h"
+    "/root/repo/src/madness/mra/leafop.h"
+    "/root/repo/src/madness/mra/nonlinsol.h"
+    "/root/repo/src/madness/mra/macrotaskq.h"
+    "/root/repo/src/madness/mra/macrotaskpartitioner.h"
+    "/root/repo/src/madness/mra/convolution_cache.h"
+    "/root/repo/src/madness/mra/checkpoint.h"
+    "/root/repo/src/madness/mra/sharedtree.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "mra" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/share/madness/0.10.1/data" TYPE FILE FILES
+    "/root/repo/src/madness/mra/autocorr"
+    "/root/repo/src/madness/mra/coeffs"
+    "/root/repo/src/madness/mra/gaussleg"
+    )
+endif()
+
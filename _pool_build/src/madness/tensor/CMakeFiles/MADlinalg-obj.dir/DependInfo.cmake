@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/madness/tensor/RandomizedMatrixDecomposition.cc" "src/madness/tensor/CMakeFiles/MADlinalg-obj.dir/RandomizedMatrixDecomposition.cc.o" "gcc" "src/madness/tensor/CMakeFiles/MADlinalg-obj.dir/RandomizedMatrixDecomposition.cc.o.d"
+  "/root/repo/src/madness/tensor/SVDTensor.cc" "src/madness/tensor/CMakeFiles/MADlinalg-obj.dir/SVDTensor.cc.o" "gcc" "src/madness/tensor/CMakeFiles/MADlinalg-obj.dir/SVDTensor.cc.o.d"
+  "/root/repo/src/madness/tensor/elem.cc" "src/madness/tensor/CMakeFiles/MADlinalg-obj.dir/elem.cc.o" "gcc" "src/madness/tensor/CMakeFiles/MADlinalg-obj.dir/elem.cc.o.d"
+  "/root/repo/src/madness/tensor/lapack.cc" "src/madness/tensor/CMakeFiles/MADlinalg-obj.dir/lapack.cc.o" "gcc" "src/madness/tensor/CMakeFiles/MADlinalg-obj.dir/lapack.cc.o.d"
+  "/root/repo/src/madness/tensor/linalg_wrappers.cc" "src/madness/tensor/CMakeFiles/MADlinalg-obj.dir/linalg_wrappers.cc.o" "gcc" "src/madness/tensor/CMakeFiles/MADlinalg-obj.dir/linalg_wrappers.cc.o.d"
+  "/root/repo/src/madness/tensor/solvers.cc" "src/madness/tensor/CMakeFiles/MADlinalg-obj.dir/solvers.cc.o" "gcc" "src/madness/tensor/CMakeFiles/MADlinalg-obj.dir/solvers.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
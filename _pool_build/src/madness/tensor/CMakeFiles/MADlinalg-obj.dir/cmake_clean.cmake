@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MADlinalg-obj.dir/RandomizedMatrixDecomposition.cc.o"
+  "CMakeFiles/MADlinalg-obj.dir/RandomizedMatrixDecomposition.cc.o.d"
+  "CMakeFiles/MADlinalg-obj.dir/SVDTensor.cc.o"
+  "CMakeFiles/MADlinalg-obj.dir/SVDTensor.cc.o.d"
+  "CMakeFiles/MADlinalg-obj.dir/elem.cc.o"
+  "CMakeFiles/MADlinalg-obj.dir/elem.cc.o.d"
+  "CMakeFiles/MADlinalg-obj.dir/lapack.cc.o"
+  "CMakeFiles/MADlinalg-obj.dir/lapack.cc.o.d"
+  "CMakeFiles/MADlinalg-obj.dir/linalg_wrappers.cc.o"
+  "CMakeFiles/MADlinalg-obj.dir/linalg_wrappers.cc.o.d"
+  "CMakeFiles/MADlinalg-obj.dir/solvers.cc.o"
+  "CMakeFiles/MADlinalg-obj.dir/solvers.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MADlinalg-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/madness/tensor/basetensor.cc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/basetensor.cc.o" "gcc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/basetensor.cc.o.d"
+  "/root/repo/src/madness/tensor/mtxmq_kernels.cc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/mtxmq_kernels.cc.o" "gcc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/mtxmq_kernels.cc.o.d"
+  "/root/repo/src/madness/tensor/tensor.cc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/tensor.cc.o" "gcc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/tensor.cc.o.d"
+  "/root/repo/src/madness/tensor/tensoriter.cc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/tensoriter.cc.o" "gcc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/tensoriter.cc.o.d"
+  "/root/repo/src/madness/tensor/vmath.cc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/vmath.cc.o" "gcc" "src/madness/tensor/CMakeFiles/MADtensor-obj.dir/vmath.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/src/madness/tensor/tensor_spec.h" "/root/repo/src/madness/tensor/tensoriter_spec.h"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
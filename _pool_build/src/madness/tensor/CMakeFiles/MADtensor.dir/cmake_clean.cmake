@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libMADtensor.a"
+  "libMADtensor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MADtensor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
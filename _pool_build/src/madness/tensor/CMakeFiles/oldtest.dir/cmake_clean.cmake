@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/oldtest.dir/oldtest.cc.o"
+  "CMakeFiles/oldtest.dir/oldtest.cc.o.d"
+  "oldtest"
+  "oldtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/oldtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tensor_unittests"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/tensor_unittests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
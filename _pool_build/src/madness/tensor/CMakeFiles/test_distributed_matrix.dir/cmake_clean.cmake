@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_distributed_matrix.dir/test_distributed_matrix.cc.o"
+  "CMakeFiles/test_distributed_matrix.dir/test_distributed_matrix.cc.o.d"
+  "test_distributed_matrix"
+  "test_distributed_matrix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_distributed_matrix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
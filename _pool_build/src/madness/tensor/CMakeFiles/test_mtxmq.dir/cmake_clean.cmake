@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_mtxmq.dir/test_mtxmq.cc.o"
+  "CMakeFiles/test_mtxmq.dir/test_mtxmq.cc.o.d"
+  "test_mtxmq"
+  "test_mtxmq.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_mtxmq.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
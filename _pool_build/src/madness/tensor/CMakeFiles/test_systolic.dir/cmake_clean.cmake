@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_systolic.dir/test_systolic.cc.o"
+  "CMakeFiles/test_systolic.dir/test_systolic.cc.o.d"
+  "test_systolic"
+  "test_systolic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_systolic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
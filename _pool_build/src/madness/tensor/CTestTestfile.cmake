@@ -0,0 +1,30 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/madness/tensor
+# Build directory: /root/repo/_pool_build/src/madness/tensor
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(madness/test/tensor/build "/usr/bin/cmake" "--build" "/root/repo/_pool_build" "--target" "tensor_unittests-madness")
+set_tests_properties(madness/test/tensor/build PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;8;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;87;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(madness/test/tensor/test_tensor/run "/root/repo/_pool_build/src/madness/tensor/test_tensor")
+set_tests_properties(madness/test/tensor/test_tensor/run PROPERTIES  DEPENDS "madness/test/tensor/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;87;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(madness/test/tensor/oldtest/run "/root/repo/_pool_build/src/madness/tensor/oldtest")
+set_tests_properties(madness/test/tensor/oldtest/run PROPERTIES  DEPENDS "madness/test/tensor/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;87;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(madness/test/tensor/test_mtxmq/run "/root/repo/_pool_build/src/madness/tensor/test_mtxmq")
+set_tests_properties(madness/test/tensor/test_mtxmq/run PROPERTIES  DEPENDS "madness/test/tensor/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;87;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(madness/test/tensor/jimkernel/run "/root/repo/_pool_build/src/madness/tensor/jimkernel")
+set_tests_properties(madness/test/tensor/jimkernel/run PROPERTIES  DEPENDS "madness/test/tensor/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;87;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(madness/test/tensor/test_Zmtxmq/run "/root/repo/_pool_build/src/madness/tensor/test_Zmtxmq")
+set_tests_properties(madness/test/tensor/test_Zmtxmq/run PROPERTIES  DEPENDS "madness/test/tensor/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;87;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(madness/test/tensor/test_systolic/run "/root/repo/_pool_build/src/madness/tensor/test_systolic")
+set_tests_properties(madness/test/tensor/test_systolic/run PROPERTIES  DEPENDS "madness/test/tensor/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;87;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(madness/test/linalg/build "/usr/bin/cmake" "--build" "/root/repo/_pool_build" "--target" "linalg_unittests-madness")
+set_tests_properties(madness/test/linalg/build PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;8;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;88;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(madness/test/linalg/test_linalg/run "/root/repo/_pool_build/src/madness/tensor/test_linalg")
+set_tests_properties(madness/test/linalg/test_linalg/run PROPERTIES  DEPENDS "madness/test/linalg/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;88;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(madness/test/linalg/test_solvers/run "/root/repo/_pool_build/src/madness/tensor/test_solvers")
+set_tests_properties(madness/test/linalg/test_solvers/run PROPERTIES  DEPENDS "madness/test/linalg/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;88;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(madness/test/linalg/testseprep/run "/root/repo/_pool_build/src/madness/tensor/testseprep")
+set_tests_properties(madness/test/linalg/testseprep/run PROPERTIES  DEPENDS "madness/test/linalg/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;88;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
+add_test(madness/test/linalg/test_distributed_matrix/run "/root/repo/_pool_build/src/madness/tensor/test_distributed_matrix")
+set_tests_properties(madness/test/linalg/test_distributed_matrix/run PROPERTIES  DEPENDS "madness/test/linalg/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/tensor/CMakeLists.txt;88;add_unittests;/root/repo/src/madness/tensor/CMakeLists.txt;0;")
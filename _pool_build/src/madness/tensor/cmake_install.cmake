@@ -0,0 +1,91 @@
+# Install script for directory: /root/repo/src/madness/tensor
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "tensor" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/_pool_build/src/madness/tensor/libMADtensor.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "tensor" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/madness/tensor" TYPE FILE FILES
+    "/root/repo/src/madness/tensor/aligned.h"
+    "/root/repo/src/madness/tensor/mxm.h"
+    "/root/repo/src/madness/tensor/tensorexcept.h"
+    "/root/repo/src/madness/tensor/tensoriter_spec.h"
+    "/root/repo/src/madness/tensor/type_data.h"
+    "/root/repo/src/madness/tensor/basetensor.h"
+    "/root/repo/src/madness/tensor/tensor.h"
+    "/root/repo/src/madness/tensor/tensor_macros.h"
+    "/root/repo/src/madness/tensor/vector_factory.h"
+    "/root/repo/src/madness/tensor/slice.h"
+    "/root/repo/src/madness/tensor/tensoriter.h"
+    "/root/repo/src/madness/tensor/tensor_spec.h"
+    "/root/repo/src/madness/tensor/vmath.h"
+    "/root/repo/src/madness/tensor/systolic.h"
+    "/root/repo/src/madness/tensor/gentensor.h"
+    "/root/repo/src/madness/tensor/srconf.h"
+    "/root/repo/src/madness/tensor/distributed_matrix.h"
+    "/root/repo/src/madness/tensor/tensortrain.h"
+    "/root/repo/src/madness/tensor/SVDTensor.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "linalg" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/_pool_build/src/madness/tensor/libMADlinalg.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "linalg" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/madness/tensor" TYPE FILE FILES
+    "/root/repo/src/madness/tensor/cblas.h"
+    "/root/repo/src/madness/tensor/cblas_types.h"
+    "/root/repo/src/madness/tensor/clapack.h"
+    "/root/repo/src/madness/tensor/clapack_fortran.h"
+    "/root/repo/src/madness/tensor/lapacke_types.h"
+    "/root/repo/src/madness/tensor/linalg_wrappers.h"
+    "/root/repo/src/madness/tensor/tensor_lapack.h"
+    "/root/repo/src/madness/tensor/solvers.h"
+    "/root/repo/src/madness/tensor/elem.h"
+    "/root/repo/src/madness/tensor/systolic_eigensolver.h"
+    )
+endif()
+
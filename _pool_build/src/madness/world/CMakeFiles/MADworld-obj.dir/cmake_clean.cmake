@@ -0,0 +1,69 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MADworld-obj.dir/archive.cc.o"
+  "CMakeFiles/MADworld-obj.dir/archive.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/archive_type_names.cc.o"
+  "CMakeFiles/MADworld-obj.dir/archive_type_names.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/binary_fstream_archive.cc.o"
+  "CMakeFiles/MADworld-obj.dir/binary_fstream_archive.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/debug.cc.o"
+  "CMakeFiles/MADworld-obj.dir/debug.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/deferred_cleanup.cc.o"
+  "CMakeFiles/MADworld-obj.dir/deferred_cleanup.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/future.cc.o"
+  "CMakeFiles/MADworld-obj.dir/future.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/group.cc.o"
+  "CMakeFiles/MADworld-obj.dir/group.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/info.cc.o"
+  "CMakeFiles/MADworld-obj.dir/info.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/lookup3.c.o"
+  "CMakeFiles/MADworld-obj.dir/lookup3.c.o.d"
+  "CMakeFiles/MADworld-obj.dir/madness_exception.cc.o"
+  "CMakeFiles/MADworld-obj.dir/madness_exception.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/numa.cc.o"
+  "CMakeFiles/MADworld-obj.dir/numa.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/parsec.cc.o"
+  "CMakeFiles/MADworld-obj.dir/parsec.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/print.cc.o"
+  "CMakeFiles/MADworld-obj.dir/print.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/redirectio.cc.o"
+  "CMakeFiles/MADworld-obj.dir/redirectio.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/safempi.cc.o"
+  "CMakeFiles/MADworld-obj.dir/safempi.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/task_storage.cc.o"
+  "CMakeFiles/MADworld-obj.dir/task_storage.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/text_fstream_archive.cc.o"
+  "CMakeFiles/MADworld-obj.dir/text_fstream_archive.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/thread.cc.o"
+  "CMakeFiles/MADworld-obj.dir/thread.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/timers.cc.o"
+  "CMakeFiles/MADworld-obj.dir/timers.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/world.cc.o"
+  "CMakeFiles/MADworld-obj.dir/world.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/world_epoch.cc.o"
+  "CMakeFiles/MADworld-obj.dir/world_epoch.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/world_task_queue.cc.o"
+  "CMakeFiles/MADworld-obj.dir/world_task_queue.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/worldam.cc.o"
+  "CMakeFiles/MADworld-obj.dir/worldam.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/worldgop.cc.o"
+  "CMakeFiles/MADworld-obj.dir/worldgop.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/worldmem.cc.o"
+  "CMakeFiles/MADworld-obj.dir/worldmem.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/worldmpi.cc.o"
+  "CMakeFiles/MADworld-obj.dir/worldmpi.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/worldmutex.cc.o"
+  "CMakeFiles/MADworld-obj.dir/worldmutex.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/worldpapi.cc.o"
+  "CMakeFiles/MADworld-obj.dir/worldpapi.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/worldprofile.cc.o"
+  "CMakeFiles/MADworld-obj.dir/worldprofile.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/worldref.cc.o"
+  "CMakeFiles/MADworld-obj.dir/worldref.cc.o.d"
+  "CMakeFiles/MADworld-obj.dir/worldrmi.cc.o"
+  "CMakeFiles/MADworld-obj.dir/worldrmi.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/MADworld-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
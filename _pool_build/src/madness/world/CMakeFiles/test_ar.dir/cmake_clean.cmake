@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_ar.dir/test_ar.cc.o"
+  "CMakeFiles/test_ar.dir/test_ar.cc.o.d"
+  "test_ar"
+  "test_ar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
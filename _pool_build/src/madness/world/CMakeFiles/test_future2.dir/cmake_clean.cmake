@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_future2.dir/test_future2.cc.o"
+  "CMakeFiles/test_future2.dir/test_future2.cc.o.d"
+  "test_future2"
+  "test_future2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_future2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_hashthreaded.dir/test_hashthreaded.cc.o"
+  "CMakeFiles/test_hashthreaded.dir/test_hashthreaded.cc.o.d"
+  "test_hashthreaded"
+  "test_hashthreaded.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_hashthreaded.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
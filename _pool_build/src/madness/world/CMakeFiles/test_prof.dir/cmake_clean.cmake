@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_prof.dir/test_prof.cc.o"
+  "CMakeFiles/test_prof.dir/test_prof.cc.o.d"
+  "test_prof"
+  "test_prof.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_prof.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_vector.dir/test_vector.cc.o"
+  "CMakeFiles/test_vector.dir/test_vector.cc.o.d"
+  "test_vector"
+  "test_vector.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_vector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
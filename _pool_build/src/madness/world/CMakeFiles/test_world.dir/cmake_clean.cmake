@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_world.dir/test_world.cc.o"
+  "CMakeFiles/test_world.dir/test_world.cc.o.d"
+  "test_world"
+  "test_world.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_world.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_worldptr.dir/test_worldptr.cc.o"
+  "CMakeFiles/test_worldptr.dir/test_worldptr.cc.o.d"
+  "test_worldptr"
+  "test_worldptr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_worldptr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
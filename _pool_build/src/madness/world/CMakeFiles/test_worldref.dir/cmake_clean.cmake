@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_worldref.dir/test_worldref.cc.o"
+  "CMakeFiles/test_worldref.dir/test_worldref.cc.o.d"
+  "test_worldref"
+  "test_worldref.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_worldref.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
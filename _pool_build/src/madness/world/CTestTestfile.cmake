@@ -0,0 +1,56 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/madness/world
+# Build directory: /root/repo/_pool_build/src/madness/world
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(madness/test/world/build "/usr/bin/cmake" "--build" "/root/repo/_pool_build" "--target" "world_unittests-madness")
+set_tests_properties(madness/test/world/build PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;8;add_test;/root/repo/src/madness/world/CMakeLists.txt;101;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_prof/run "/root/repo/_pool_build/src/madness/world/test_prof")
+set_tests_properties(madness/test/world/test_prof/run PROPERTIES  DEPENDS "madness/test/world/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/world/CMakeLists.txt;101;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_ar/run "/root/repo/_pool_build/src/madness/world/test_ar")
+set_tests_properties(madness/test/world/test_ar/run PROPERTIES  DEPENDS "madness/test/world/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/world/CMakeLists.txt;101;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_hashdc/run "/root/repo/_pool_build/src/madness/world/test_hashdc")
+set_tests_properties(madness/test/world/test_hashdc/run PROPERTIES  DEPENDS "madness/test/world/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/world/CMakeLists.txt;101;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_hello/run "/root/repo/_pool_build/src/madness/world/test_hello")
+set_tests_properties(madness/test/world/test_hello/run PROPERTIES  DEPENDS "madness/test/world/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/world/CMakeLists.txt;101;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_atomicint/run "/root/repo/_pool_build/src/madness/world/test_atomicint")
+set_tests_properties(madness/test/world/test_atomicint/run PROPERTIES  DEPENDS "madness/test/world/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/world/CMakeLists.txt;101;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_future/run "/root/repo/_pool_build/src/madness/world/test_future")
+set_tests_properties(madness/test/world/test_future/run PROPERTIES  DEPENDS "madness/test/world/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/world/CMakeLists.txt;101;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_future2/run "/root/repo/_pool_build/src/madness/world/test_future2")
+set_tests_properties(madness/test/world/test_future2/run PROPERTIES  DEPENDS "madness/test/world/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/world/CMakeLists.txt;101;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_future3/run "/root/repo/_pool_build/src/madness/world/test_future3")
+set_tests_properties(madness/test/world/test_future3/run PROPERTIES  DEPENDS "madness/test/world/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/world/CMakeLists.txt;101;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_dc/run "/root/repo/_pool_build/src/madness/world/test_dc")
+set_tests_properties(madness/test/world/test_dc/run PROPERTIES  DEPENDS "madness/test/world/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/world/CMakeLists.txt;101;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_hashthreaded/run "/root/repo/_pool_build/src/madness/world/test_hashthreaded")
+set_tests_properties(madness/test/world/test_hashthreaded/run PROPERTIES  DEPENDS "madness/test/world/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/world/CMakeLists.txt;101;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_queue/run "/root/repo/_pool_build/src/madness/world/test_queue")
+set_tests_properties(madness/test/world/test_queue/run PROPERTIES  DEPENDS "madness/test/world/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/world/CMakeLists.txt;101;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_world/run "/root/repo/_pool_build/src/madness/world/test_world")
+set_tests_properties(madness/test/world/test_world/run PROPERTIES  DEPENDS "madness/test/world/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/world/CMakeLists.txt;101;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_worldprofile/run "/root/repo/_pool_build/src/madness/world/test_worldprofile")
+set_tests_properties(madness/test/world/test_worldprofile/run PROPERTIES  DEPENDS "madness/test/world/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/world/CMakeLists.txt;101;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_binsorter/run "/root/repo/_pool_build/src/madness/world/test_binsorter")
+set_tests_properties(madness/test/world/test_binsorter/run PROPERTIES  DEPENDS "madness/test/world/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/world/CMakeLists.txt;101;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_vector/run "/root/repo/_pool_build/src/madness/world/test_vector")
+set_tests_properties(madness/test/world/test_vector/run PROPERTIES  DEPENDS "madness/test/world/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/world/CMakeLists.txt;101;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_worldptr/run "/root/repo/_pool_build/src/madness/world/test_worldptr")
+set_tests_properties(madness/test/world/test_worldptr/run PROPERTIES  DEPENDS "madness/test/world/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/world/CMakeLists.txt;101;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_worldref/run "/root/repo/_pool_build/src/madness/world/test_worldref")
+set_tests_properties(madness/test/world/test_worldref/run PROPERTIES  DEPENDS "madness/test/world/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/world/CMakeLists.txt;101;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_stack/run "/root/repo/_pool_build/src/madness/world/test_stack")
+set_tests_properties(madness/test/world/test_stack/run PROPERTIES  DEPENDS "madness/test/world/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/world/CMakeLists.txt;101;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_googletest/run "/root/repo/_pool_build/src/madness/world/test_googletest")
+set_tests_properties(madness/test/world/test_googletest/run PROPERTIES  DEPENDS "madness/test/world/build" WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/world/CMakeLists.txt;101;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_tree/run "/root/repo/_pool_build/src/madness/world/test_tree")
+set_tests_properties(madness/test/world/test_tree/run PROPERTIES  DEPENDS "madness/test/world/build" _BACKTRACE_TRIPLES "/root/repo/cmake/modules/AddUnittests.cmake;21;add_test;/root/repo/src/madness/world/CMakeLists.txt;101;add_unittests;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_queue/run_work_stealing "/root/repo/_pool_build/src/madness/world/test_queue")
+set_tests_properties(madness/test/world/test_queue/run_work_stealing PROPERTIES  DEPENDS "madness/test/world/build" ENVIRONMENT "MAD_WORK_STEALING=1" _BACKTRACE_TRIPLES "/root/repo/src/madness/world/CMakeLists.txt;118;add_test;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_queue/run_numa "/root/repo/_pool_build/src/madness/world/test_queue")
+set_tests_properties(madness/test/world/test_queue/run_numa PROPERTIES  DEPENDS "madness/test/world/build" ENVIRONMENT "MAD_NUMA=1" _BACKTRACE_TRIPLES "/root/repo/src/madness/world/CMakeLists.txt;122;add_test;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_world/run_work_stealing "/root/repo/_pool_build/src/madness/world/test_world")
+set_tests_properties(madness/test/world/test_world/run_work_stealing PROPERTIES  DEPENDS "madness/test/world/build" ENVIRONMENT "MAD_WORK_STEALING=1" _BACKTRACE_TRIPLES "/root/repo/src/madness/world/CMakeLists.txt;118;add_test;/root/repo/src/madness/world/CMakeLists.txt;0;")
+add_test(madness/test/world/test_world/run_numa "/root/repo/_pool_build/src/madness/world/test_world")
+set_tests_properties(madness/test/world/test_world/run_numa PROPERTIES  DEPENDS "madness/test/world/build" ENVIRONMENT "MAD_NUMA=1" _BACKTRACE_TRIPLES "/root/repo/src/madness/world/CMakeLists.txt;122;add_test;/root/repo/src/madness/world/CMakeLists.txt;0;")
@@ -441,7 +441,7 @@ double XCOperator<T, NDIM>::compute_xc_energy() const {
 
     refine_to_common_level(world, xc_args);
     real_function_3d vlda = multiop_values<double, xc_functional, 3>
-            (xc_functional(*xc), xc_args);
+            (xc_functional(*xc), xc_args, xc->get_batchsize());
     truncate(world, xc_args);
 
     return vlda.trace();
@@ -459,7 +459,7 @@ real_function_3d XCOperator<T, NDIM>::make_xc_potential() const {
 
     // compute all the contributions to the xc kernel
     xc_potential op(*xc, ispin);
-    const vecfuncT intermediates = multi_to_multi_op_values(op, xc_args);
+    const vecfuncT intermediates = multi_to_multi_op_values(op, xc_args, true, xc->get_batchsize());
 
     // local part, first term in Yanai2005, Eq. (12)
     real_function_3d dft_pot = intermediates[0];
@@ -540,7 +540,7 @@ real_function_3d XCOperator<T, NDIM>::apply_xc_kernel(const real_function_3d &de
 
     // compute all the contributions to the xc kernel
     xc_kernel_apply op(*xc, ispin);
-    const vecfuncT intermediates = multi_to_multi_op_values(op, xc_args);
+    const vecfuncT intermediates = multi_to_multi_op_values(op, xc_args, true, xc->get_batchsize());
 
     // lda potential and local parts of the gga potential
     real_function_3d result = intermediates[0];
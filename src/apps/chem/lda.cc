@@ -343,4 +343,49 @@ int c_uks_vwn5__(double *ra, double *rb, double * f, double *dfdra, double *dfdr
     return 0;
 } /* c_uks_vwn5__ */
 
+/* ----------------------------------------------------------------------- */
+
+/*     Closed shell Slater exchange plus VWN5 correlation for n points,   */
+/*     i.e. the sum of x_rks_s__ and c_rks_vwn5__.  Written as one loop    */
+/*     without calls and branches so that the compiler can vectorize it.   */
+
+/*     Parameters: */
+/*     n     the number of points */
+/*     r     the total electron density at each point */
+/*     f     On return the functional values */
+/*     dfdra On return the derivatives of f with respect to the alpha */
+/*           electron density */
+
+void xc_rks_svwn5_array(const long n, const double * __restrict r__,
+                        double * __restrict f, double * __restrict dfdra) {
+
+    const double a2 = .0621814, b2 = 3.72744, c2 = 12.9352, d2 = -.10498;
+    const double t4 = .620350490899399531;
+    const double p1 = 6.1519908197590798, p2 = a2 * .5;
+    const double p3 = 9.6902277115443745e-4, p4 = .038783294878113009;
+
+    for (long i=0; i<n; ++i) {
+        const double srho = r__[i];
+        const double srho13 = std::cbrt(srho);
+
+        /* exchange */
+        const double ra13 = srho13 * 0.793700525984099737375852819636154;
+        const double fx = ra13 * srho * -0.930525736349100025002010218071667;
+        const double dx = ra13 * -1.24070098179880003333601362409556;
+
+        /* correlation */
+        const double iv2 = t4 / srho13;
+        const double iv = sqrt(iv2);
+        const double inv = 1. / (iv2 + b2 * iv + c2);
+        const double i1 = log(iv2 * inv);
+        const double i2 = log((iv - d2) * (iv - d2) * inv);
+        const double i3 = atan(p1 / (iv * 2. + b2));
+        const double pp1 = p2 * i1 + p3 * i2 + p4 * i3;
+        const double pp2 = a2 * (1. / iv - iv * inv * (b2 / (iv - d2) + 1.));
+
+        f[i] = fx + pp1 * srho;
+        dfdra[i] = dx + pp1 - iv * .166666666666666666666666666666 * pp2;
+    }
+} /* xc_rks_svwn5_array */
+
 }
@@ -32,6 +32,7 @@
 //#define WORLD_INSTANTIATE_STATIC_TEMPLATES
 #include <madness/world/MADworld.h>
 #include <madness/mra/mra.h>
+#include <madness/mra/vmra.h>
 #include <madness/tensor/tensor.h>
 #include <fstream>
 #include "xcfunctional.h"
@@ -307,12 +308,74 @@ void test_xcfunctional(World& world)
 
 }
 
+/// density of a few atoms as a sum of Gaussians
+static double model_density(const coord_3d& r) {
+    static const double centers[3][3]={{0.0,0.0,-0.22},{0.0,1.43,0.89},{0.0,-1.43,0.89}};
+    static const double charges[3]={8.0,1.0,1.0};
+    double rho=0.0;
+    for (int i=0; i<3; ++i) {
+        const double x=r[0]-centers[i][0], y=r[1]-centers[i][1], z=r[2]-centers[i][2];
+        const double a=charges[i];
+        rho+=charges[i]*std::pow(a/constants::pi,1.5)*exp(-a*(x*x+y*y+z*z));
+    }
+    return rho;
+}
+
+/// time the xc potential and energy for different numbers of boxes per functional call
+void benchmark_xcfunctional(World& world) {
+    FunctionDefaults<3>::set_cubic_cell(-10.0,10.0);
+    FunctionDefaults<3>::set_k(8);
+    FunctionDefaults<3>::set_thresh(1.e-6);
+
+    XCfunctional xc;
+    xc.initialize("LDA",false,world);
+
+    std::vector<real_function_3d> xc_args(XCfunctional::number_xc_args);
+    xc_args[XCfunctional::enum_rhoa]=real_factory_3d(world).f(model_density);
+    const double npoint=xc_args[XCfunctional::enum_rhoa].size();
+    if (world.rank()==0) print("benchmark xc functional on",npoint,"points");
+
+    real_function_3d vref;
+    double eref=0.0;
+    for (std::size_t batchsize : {1, 8, 32, 128}) {
+        xc.set_batchsize(batchsize);
+        world.gop.fence();
+        double wall=wall_time();
+        real_function_3d vxc=multi_to_multi_op_values(xc_potential(xc,0), xc_args,
+                true, batchsize)[0];
+        const double t_vxc=wall_time()-wall;
+
+        wall=wall_time();
+        const double exc=multiop_values<double,xc_functional,3>(xc_functional(xc),
+                xc_args, batchsize).trace();
+        const double t_exc=wall_time()-wall;
+
+        if (batchsize==1) {
+            vref=vxc;
+            eref=exc;
+        }
+        const double error=(vxc-vref).norm2();
+        if (world.rank()==0) printf("boxes/call %4ld  vxc %7.3fs (%6.2f Mpoints/s)  "
+                "exc %7.3fs  error vxc %.1e exc %.1e\n", long(batchsize), t_vxc,
+                1.e-6*npoint/t_vxc, t_exc, error, std::abs(exc-eref));
+        MADNESS_CHECK(error<1.e-10 and std::abs(exc-eref)<1.e-10);
+    }
+}
+
 int main(int argc, char** argv) {
     madness::initialize(argc, argv);
 
     madness::World world(SafeMPI::COMM_WORLD);
     world.gop.fence();
 
+    // testxc --benchmark times the batched evaluation of the functional
+    if (argc>1 and std::string(argv[1])=="--benchmark") {
+        startup(world,argc,argv);
+        benchmark_xcfunctional(world);
+        madness::finalize();
+        return 0;
+    }
+
     test_xcfunctional(world);
 
     madness::finalize();
@@ -87,6 +87,15 @@ public:
     /// return the munging threshold for the density
     double get_rhotol() const {return rhotol;}
 
+    /// return the value munged densities are set to
+    double get_rhomin() const {return rhomin;}
+
+    /// the number of boxes whose points are evaluated in one call of the functional
+    std::size_t get_batchsize() const {return batchsize;}
+
+    /// set the number of boxes evaluated in one call, 1 evaluates box by box
+    void set_batchsize(const std::size_t n) {batchsize=std::max(std::size_t(1),n);}
+
     /// return the binary munging threshold for the final result in the GGA potential/kernel
 
     /// the GGA potential will be munged based on the smallness of the original
@@ -99,6 +108,7 @@ protected:
     double hf_coeff;            ///< Factor multiplying HF exchange (+1.0 gives HF)
     double rhomin, rhotol;      ///< See initialize and munge*
     double ggatol;              ///< See initialize and munge*
+    std::size_t batchsize=32;   ///< number of boxes per evaluation, see get_batchsize
 
 #ifdef MADNESS_HAS_LIBXC
     std::vector< std::pair<xc_func_type*,double> > funcs;
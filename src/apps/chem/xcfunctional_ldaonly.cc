@@ -15,6 +15,35 @@ int x_rks_s__(const double *r__, double *f, double * dfdra);
 int c_rks_vwn5__(const double *r__, double *f, double * dfdra);
 int x_uks_s__(double *ra, double *rb, double *f, double *dfdra, double *dfdrb);
 int c_uks_vwn5__(double *ra, double *rb, double *f, double *dfdra, double *dfdrb);
+void xc_rks_svwn5_array(const long n, const double *r, double *f, double *dfdra);
+
+/// munge the closed shell density and evaluate Slater+VWN5 on all points at once
+static void xc_rks_svwn5(const XCfunctional& xc, const Tensor<double>& arho,
+        Tensor<double>& f, Tensor<double>& dfdr) {
+    const long np=arho.size();
+    const double rhotol=xc.get_rhotol();
+    const double rhomin=xc.get_rhomin();
+    const double* MADNESS_RESTRICT a=arho.ptr();
+    Tensor<double> r(np);
+    double* MADNESS_RESTRICT rp=r.ptr();
+    for (long i=0; i<np; i++) {
+        const double ri=2.0*a[i];
+        rp[i]=(ri<=rhotol) ? rhomin : ri;
+    }
+    f=Tensor<double>(3L, arho.dims(), false);
+    dfdr=Tensor<double>(3L, arho.dims(), false);
+    xc_rks_svwn5_array(np, rp, f.ptr(), dfdr.ptr());
+
+    // check once after the loop instead of inside
+    const double* fp=f.ptr();
+    const double* dp=dfdr.ptr();
+    for (long i=0; i<np; i++) {
+        if (std::isnan(fp[i]) or std::isnan(dp[i])) {
+            print("bad? 2", rp[i]);
+            throw "numerical error in lda functional";
+        }
+    }
+}
 
 XCfunctional::XCfunctional() : hf_coeff(0.0) {
     rhotol=1e-7; rhomin=1e-12; // default values
@@ -101,17 +130,8 @@ madness::Tensor<double> XCfunctional::exc(const std::vector< madness::Tensor<dou
         }
     }
     else {
-        double q1, q2, dq;
-        for (unsigned int i=0; i<result.size(); i++) {
-            double r = munge(2.0 * arho[i]);
-            x_rks_s__(&r, &q1, &dq);
-            c_rks_vwn5__(&r, &q2, &dq);
-            f[i] = q1 + q2;
-            if (std::isnan(f[i])) {
-                print("bad? 2", r);
-                throw "numerical error in lda functional";
-            }
-        }
+        Tensor<double> dfdr;
+        xc_rks_svwn5(*this, t[0], result, dfdr);
     }
     return result;
 }
@@ -144,18 +164,8 @@ std::vector<madness::Tensor<double> > XCfunctional::vxc(const std::vector< madne
         }
     }
     else {
-        const double* arho = t[0].ptr();
-        for (unsigned int i=0; i<result[0].size(); i++) {
-            double r = munge(2.0 * arho[i]);
-            double q, dq1, dq2;
-            x_rks_s__(&r, &q, &dq1);
-            c_rks_vwn5__(&r, &q, &dq2);
-            f[i] = dq1 + dq2;
-            if (std::isnan(f[i])) {
-                print("bad? 4", r);
-                throw "numerical error in lda functional";
-            }
-        }
+        Tensor<double> exc;
+        xc_rks_svwn5(*this, t[0], exc, result[0]);
     }
     return result;
 }
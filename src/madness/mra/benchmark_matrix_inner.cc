@@ -0,0 +1,123 @@
+/*
+  This file is part of MADNESS.
+
+  Copyright (C) 2007,2010 Oak Ridge National Laboratory
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+
+  For more information please contact:
+
+  Robert J. Harrison
+  Oak Ridge National Laboratory
+  One Bethel Valley Road
+  P.O. Box 2008, MS-6367
+
+  email: harrisonrj@ornl.gov
+  tel:   865-241-3937
+  fax:   865-572-0680
+*/
+
+/// \file benchmark_matrix_inner.cc
+/// \brief Times matrix_inner for an increasing number of functions
+
+/// Usage: benchmark_matrix_inner [k=8] [thresh=1e-5] [n1 n2 ...]
+///
+/// For each n a vector of n random Gaussians in 3D is projected and the
+/// n x n overlap matrix is computed with and without \c sym.  For small
+/// n the result is checked against \c matrix_inner_old.
+
+#include <madness/mra/mra.h>
+#include <madness/mra/vmra.h>
+#include <madness/misc/ran.h>
+#include <madness/constants.h>
+
+using namespace madness;
+
+static const std::size_t NDIM = 3;
+
+class RandomGaussian : public FunctionFunctorInterface<double,NDIM> {
+    coord_3d center;
+    double expnt, coeff;
+public:
+    RandomGaussian(const Tensor<double>& cell) {
+        for (std::size_t i=0; i<NDIM; ++i)
+            center[i] = 0.5*(RandomValue<double>()*(cell(i,1)-cell(i,0)) + cell(i,0));
+        expnt = 0.5 + 4.0*RandomValue<double>();
+        coeff = pow(2.0*expnt/constants::pi,0.25*NDIM);
+    }
+
+    double operator()(const coord_3d& x) const {
+        double rsq = 0.0;
+        for (std::size_t i=0; i<NDIM; ++i) rsq += (x[i]-center[i])*(x[i]-center[i]);
+        return coeff*exp(-expnt*rsq);
+    }
+};
+
+int main(int argc, char** argv) {
+    initialize(argc, argv);
+    {
+        World world(SafeMPI::COMM_WORLD);
+        startup(world,argc,argv);
+
+        int k = 8;
+        double thresh = 1e-5;
+        std::vector<long> nfunc;
+        if (argc > 1) k = atoi(argv[1]);
+        if (argc > 2) thresh = atof(argv[2]);
+        for (int iarg=3; iarg<argc; ++iarg) nfunc.push_back(atol(argv[iarg]));
+        if (nfunc.empty()) nfunc = {25, 50, 100, 200, 400};
+
+        FunctionDefaults<NDIM>::set_cubic_cell(-10.0, 10.0);
+        FunctionDefaults<NDIM>::set_k(k);
+        FunctionDefaults<NDIM>::set_thresh(thresh);
+        FunctionDefaults<NDIM>::set_refine(true);
+        FunctionDefaults<NDIM>::set_initial_level(2);
+
+        if (world.rank() == 0) {
+            print("k", k, "thresh", thresh, "nproc", world.size(), "nthread", ThreadPool::size());
+            printf("\n%8s %12s %12s %12s %12s\n", "n", "sym (s)", "nosym (s)", "old (s)", "error");
+        }
+
+        for (long n : nfunc) {
+            std::vector<real_function_3d> f(n);
+            for (long i=0; i<n; ++i) {
+                f[i] = real_factory_3d(world).functor(
+                        std::shared_ptr<FunctionFunctorInterface<double,NDIM> >(
+                                new RandomGaussian(FunctionDefaults<NDIM>::get_cell())));
+            }
+            compress(world, f);
+            std::vector<real_function_3d> g = copy(world, f);
+
+            world.gop.fence();
+            double t0 = wall_time();
+            Tensor<double> s = matrix_inner(world, f, f, true);
+            double t1 = wall_time();
+            Tensor<double> r = matrix_inner(world, f, g, false);
+            double t2 = wall_time();
+
+            double told = 0.0, err = (s - r).normf();
+            if (n <= 100) {
+                Tensor<double> old = matrix_inner_old(world, f, g, false);
+                told = wall_time() - t2;
+                err = std::max(err, (old - r).normf());
+            }
+            if (world.rank() == 0)
+                printf("%8ld %12.3f %12.3f %12.3f %12.2e\n", n, t1-t0, t2-t1, told, err);
+        }
+        world.gop.fence();
+    }
+    finalize();
+    return 0;
+}
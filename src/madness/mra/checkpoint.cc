@@ -0,0 +1,288 @@
+/*
+  This file is part of MADNESS.
+
+  Copyright (C) 2007,2010 Oak Ridge National Laboratory
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+
+  For more information please contact:
+
+  Robert J. Harrison
+  Oak Ridge National Laboratory
+  One Bethel Valley Road
+  P.O. Box 2008, MS-6367
+
+  email: harrisonrj@ornl.gov
+  tel:   865-241-3937
+  fax:   865-572-0680
+
+  $Id$
+*/
+
+/// \file mra/checkpoint.cc
+/// \brief I/O thread and compression of checkpoints written by save_async()
+
+#include <madness/mra/checkpoint.h>
+
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+
+namespace madness {
+
+    namespace detail {
+
+        namespace {
+
+            // A compressed file is a CompressedHeader followed by the
+            // encoded contents of the uncompressed file
+            const char compressed_magic[8] = {'M','A','D','C','K','P','Z','\0'};
+            const uint32_t compressed_version = 1;
+
+            struct CompressedHeader {
+                char magic[8];
+                uint32_t version;
+                uint32_t reserved;
+                uint64_t rawsize;
+            };
+
+            void put_varint(std::vector<unsigned char>& out, uint64_t n) {
+                while (n >= 0x80) {
+                    out.push_back((unsigned char)(n | 0x80));
+                    n >>= 7;
+                }
+                out.push_back((unsigned char)(n));
+            }
+
+            uint64_t get_varint(const unsigned char*& p, const unsigned char* end) {
+                uint64_t n = 0;
+                for (int shift=0; p<end && shift<64; shift+=7) {
+                    const unsigned char c = *p++;
+                    n |= uint64_t(c & 0x7f) << shift;
+                    if (!(c & 0x80)) return n;
+                }
+                MADNESS_EXCEPTION("checkpoint: corrupt compressed data", 0);
+            }
+
+            // The coefficients are mostly 8-byte words.  Gathering byte i
+            // of every word into plane i collects the low-order mantissa
+            // bytes (zero after lossy truncation) and the exponent bytes
+            // (which vary little) into long runs.  Runs of zeros are then
+            // replaced by their length: the stream is a sequence of
+            // (nliteral, literal bytes, nzero).
+            void encode(const std::vector<unsigned char>& in, std::vector<unsigned char>& out) {
+                const std::size_t n = in.size(), nword = n/8;
+                std::vector<unsigned char> s(n);
+                for (std::size_t w=0; w<nword; ++w) {
+                    for (int b=0; b<8; ++b) s[b*nword + w] = in[8*w + b];
+                }
+                for (std::size_t i=8*nword; i<n; ++i) s[i] = in[i];
+
+                const std::size_t minrun = 8;
+                std::size_t i = 0;
+                while (i < n) {
+                    // Find the next run of at least minrun zeros (or trailing zeros)
+                    std::size_t j = i, litend = n;
+                    while (j < n) {
+                        if (s[j]) {
+                            ++j;
+                            continue;
+                        }
+                        std::size_t k = j;
+                        while (k < n && s[k] == 0) ++k;
+                        if (k-j >= minrun || k == n) {
+                            litend = j;
+                            break;
+                        }
+                        j = k;
+                    }
+                    put_varint(out, litend - i);
+                    out.insert(out.end(), s.begin()+i, s.begin()+litend);
+                    std::size_t k = litend;
+                    while (k < n && s[k] == 0) ++k;
+                    put_varint(out, k - litend);
+                    i = k;
+                }
+            }
+
+            void decode(const unsigned char* p, const unsigned char* end, std::size_t n, std::vector<unsigned char>& out) {
+                std::vector<unsigned char> s;
+                s.reserve(n);
+                while (s.size() < n) {
+                    const uint64_t nlit = get_varint(p, end);
+                    if (nlit > uint64_t(end-p) || s.size()+nlit > n) MADNESS_EXCEPTION("checkpoint: corrupt compressed data", 1);
+                    s.insert(s.end(), p, p+nlit);
+                    p += nlit;
+                    const uint64_t nzero = get_varint(p, end);
+                    if (s.size()+nzero > n) MADNESS_EXCEPTION("checkpoint: corrupt compressed data", 2);
+                    s.resize(s.size()+nzero, 0);
+                }
+
+                const std::size_t nword = n/8;
+                out.resize(n);
+                for (std::size_t w=0; w<nword; ++w) {
+                    for (int b=0; b<8; ++b) out[8*w + b] = s[b*nword + w];
+                }
+                for (std::size_t i=8*nword; i<n; ++i) out[i] = s[i];
+            }
+
+            std::string file_name(const std::string& name, ProcessID rank) {
+                char buf[16];
+                snprintf(buf, sizeof(buf), ".%5.5d", rank);
+                return name + buf;
+            }
+
+            void write_job(CheckpointJob& job) {
+                std::vector<unsigned char> compressed;
+                const std::vector<unsigned char>* out = &job.data;
+                if (job.compression != CheckpointCompression::None) {
+                    CompressedHeader h;
+                    std::memcpy(h.magic, compressed_magic, sizeof(h.magic));
+                    h.version = compressed_version;
+                    h.reserved = 0;
+                    h.rawsize = job.data.size();
+                    const unsigned char* ph = reinterpret_cast<const unsigned char*>(&h);
+                    compressed.reserve(job.data.size()/2);
+                    compressed.insert(compressed.end(), ph, ph+sizeof(h));
+                    encode(job.data, compressed);
+                    out = &compressed;
+                }
+
+                const std::string tmpname = job.filename + ".tmp";
+                std::ofstream f(tmpname.c_str(), std::ios::binary | std::ios::trunc);
+                f.write(reinterpret_cast<const char*>(out->data()), out->size());
+                f.close();
+                job.failed = !f || std::rename(tmpname.c_str(), job.filename.c_str());
+                std::vector<unsigned char>().swap(job.data);
+            }
+
+            /// The I/O thread of this process and its queue of jobs
+            class CheckpointWriter {
+                PthreadConditionVariable cv;
+                std::deque< std::shared_ptr<CheckpointJob> > queue;
+                Thread thread;
+
+                static void* main(void* self) {
+                    static_cast<CheckpointWriter*>(self)->run();
+                    return 0;
+                }
+
+                void run() {
+                    while (true) {
+                        cv.lock();
+                        while (queue.empty()) cv.wait();
+                        std::shared_ptr<CheckpointJob> job = queue.front();
+                        queue.pop_front();
+                        cv.unlock();
+
+                        try {
+                            write_job(*job);
+                        }
+                        catch (...) {
+                            job->failed = true;
+                        }
+                        job->done.store(true, std::memory_order_release);
+                    }
+                }
+
+            public:
+                CheckpointWriter() {
+                    thread.start(main, this);
+                }
+
+                void submit(const std::shared_ptr<CheckpointJob>& job) {
+                    cv.lock();
+                    queue.push_back(job);
+                    cv.signal();
+                    cv.unlock();
+                }
+            };
+
+            // Started on first use and never stopped ... it idles in wait()
+            CheckpointWriter& writer() {
+                static CheckpointWriter* w = new CheckpointWriter;
+                return *w;
+            }
+
+        }  // namespace
+
+
+        CheckpointJob::CheckpointJob(const std::string& name, ProcessID rank, CheckpointCompression compression)
+            : filename(file_name(name, rank))
+            , compression(compression)
+            , done(false)
+            , failed(false)
+        {}
+
+
+        void checkpoint_submit(const std::shared_ptr<CheckpointJob>& job) {
+            writer().submit(job);
+        }
+
+
+        void checkpoint_read(const std::string& name, ProcessID rank, std::vector<unsigned char>& data) {
+            const std::string filename = file_name(name, rank);
+            std::ifstream f(filename.c_str(), std::ios::binary);
+            if (!f) MADNESS_EXCEPTION("checkpoint: failed to open file", rank);
+            std::vector<unsigned char> buf((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+
+            if (buf.size() >= sizeof(CompressedHeader) &&
+                std::memcmp(buf.data(), compressed_magic, sizeof(compressed_magic)) == 0) {
+                CompressedHeader h;
+                std::memcpy(&h, buf.data(), sizeof(h));
+                if (h.version != compressed_version) MADNESS_EXCEPTION("checkpoint: unknown version", h.version);
+                decode(buf.data()+sizeof(h), buf.data()+buf.size(), h.rawsize, data);
+            }
+            else if (buf.size() >= sizeof(ARCHIVE_COOKIE) &&
+                     std::memcmp(buf.data(), ARCHIVE_COOKIE, sizeof(ARCHIVE_COOKIE)) == 0) {
+                data.swap(buf);
+            }
+            else {
+                MADNESS_EXCEPTION("checkpoint: not a checkpoint file", rank);
+            }
+        }
+
+
+        void checkpoint_quantize(double* x, long n, double tol) {
+            const int etol = std::ilogb(tol);
+            for (long i=0; i<n; ++i) {
+                const double a = std::abs(x[i]);
+                if (a < tol) {
+                    x[i] = 0.0;
+                    continue;
+                }
+                if (!std::isfinite(a)) continue;
+                // Keep the leading nkeep bits of the mantissa ... the error
+                // is below 2^(ilogb(a)-nkeep) = 2^etol <= tol
+                const int nkeep = std::ilogb(a) - etol;
+                if (nkeep >= 52) continue;
+                uint64_t bits;
+                std::memcpy(&bits, x+i, sizeof(bits));
+                bits &= ~((uint64_t(1) << (52-nkeep)) - 1);
+                std::memcpy(x+i, &bits, sizeof(bits));
+            }
+        }
+
+    }  // namespace detail
+
+
+    void CheckpointHandle::wait() const {
+        if (!job) return;
+        ThreadPool::await([this]() { return probe(); }, true, true);
+        if (job->failed) MADNESS_EXCEPTION("checkpoint: writing file failed", 0);
+    }
+
+}
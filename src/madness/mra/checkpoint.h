@@ -0,0 +1,227 @@
+/*
+  This file is part of MADNESS.
+
+  Copyright (C) 2007,2010 Oak Ridge National Laboratory
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+
+  For more information please contact:
+
+  Robert J. Harrison
+  Oak Ridge National Laboratory
+  One Bethel Valley Road
+  P.O. Box 2008, MS-6367
+
+  email: harrisonrj@ornl.gov
+  tel:   865-241-3937
+  fax:   865-572-0680
+
+  $Id$
+*/
+#ifndef MADNESS_MRA_CHECKPOINT_H__INCLUDED
+#define MADNESS_MRA_CHECKPOINT_H__INCLUDED
+
+/// \file mra/checkpoint.h
+/// \brief Checkpointing of functions with the write overlapped with computation
+
+#include <madness/mra/mra.h>
+#include <madness/world/vector_archive.h>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace madness {
+
+    /// Compression of the checkpoint files written by save_async()
+    enum class CheckpointCompression {
+        None,       ///< Same format as save()/save_function() ... can also be read by load()/load_function()
+        Lossless,   ///< Byte planes of 8-byte words with zero runs removed
+        Lossy       ///< Coefficients truncated to an absolute accuracy and then compressed as Lossless
+    };
+
+    namespace detail {
+
+        /// One background write ... shared by the caller and the I/O thread
+        struct CheckpointJob {
+            std::string filename;
+            CheckpointCompression compression;
+            std::vector<unsigned char> data;    ///< Contents of the file written by save() on this process
+            std::atomic<bool> done;
+            bool failed;
+
+            CheckpointJob(const std::string& name, ProcessID rank, CheckpointCompression compression);
+        };
+
+        /// Queue the job for the I/O thread of this process
+        void checkpoint_submit(const std::shared_ptr<CheckpointJob>& job);
+
+        /// Read (and if necessary decompress) the file of process rank of a checkpoint
+        void checkpoint_read(const std::string& name, ProcessID rank, std::vector<unsigned char>& data);
+
+        /// Zero the mantissa bits of x[i] that are below tol (and values below tol)
+        void checkpoint_quantize(double* x, long n, double tol);
+
+        template <typename T, std::size_t NDIM>
+        struct checkpoint_quantize_op {
+            double tol;
+
+            checkpoint_quantize_op(double tol) : tol(tol) {}
+
+            void operator()(const Key<NDIM>& key, FunctionNode<T,NDIM>& node) const {
+                // Low rank coefficients are left alone
+                if (node.has_coeff() && node.coeff().is_full_tensor()) {
+                    Tensor<T>& t = node.coeff().get_tensor();
+                    if constexpr (std::is_same<typename TensorTypeData<T>::scalar_type,double>::value) {
+                        checkpoint_quantize(reinterpret_cast<double*>(t.ptr()), t.size()*sizeof(T)/sizeof(double), tol);
+                    }
+                }
+            }
+        };
+
+        template <typename T, std::size_t NDIM>
+        Function<T,NDIM> checkpoint_copy(const Function<T,NDIM>& f, CheckpointCompression compression, double tol) {
+            if (compression != CheckpointCompression::Lossy) return f;
+            Function<T,NDIM> g = copy(f);
+            g.unaryop_node(checkpoint_quantize_op<T,NDIM>(tol > 0.0 ? tol : 0.01*f.thresh()));
+            return g;
+        }
+
+        /// Serialize into the in-memory image of the file of this process of a parallel archive with one writer per process
+        template <typename T, std::size_t NDIM>
+        std::shared_ptr<CheckpointJob>
+        checkpoint_snapshot(World& world, const std::vector< Function<T,NDIM> >& f, bool isvector,
+                            const std::string& name, CheckpointCompression compression, double tol) {
+            std::shared_ptr<CheckpointJob> job(new CheckpointJob(name, world.rank(), compression));
+            archive::VectorOutputArchive var(job->data);
+            var.store(ARCHIVE_COOKIE, std::strlen(ARCHIVE_COOKIE)+1);
+            int nio = world.size();
+            if (world.rank() == 0) var & nio;
+            archive::ParallelOutputArchive<archive::VectorOutputArchive> ar(world, var, nio);
+            std::size_t n = f.size();
+            if (isvector) ar & n;
+            for (std::size_t i=0; i<n; ++i) {
+                const Function<T,NDIM> g = checkpoint_copy(f[i], compression, tol);
+                ar & g;
+            }
+            return job;
+        }
+
+        template <typename T, std::size_t NDIM>
+        void checkpoint_load(World& world, std::vector< Function<T,NDIM> >& f, bool isvector, const std::string& name) {
+            std::vector<unsigned char> data;
+            if (world.rank() == 0) checkpoint_read(name, 0, data);
+            archive::VectorInputArchive var(data);
+            char cookie[sizeof(ARCHIVE_COOKIE)];
+            int nio = 0;
+            if (world.rank() == 0) {
+                var.load(cookie, sizeof(cookie));
+                var & nio;
+            }
+            world.gop.broadcast(nio, 0);
+            MADNESS_CHECK(nio <= world.size());
+            if (world.rank() && world.rank() < nio) {
+                checkpoint_read(name, world.rank(), data);
+                var.load(cookie, sizeof(cookie));
+            }
+            archive::ParallelInputArchive<archive::VectorInputArchive> ar(world, var, nio);
+            std::size_t n = 1;
+            if (isvector) ar & n;
+            f.resize(n);
+            for (std::size_t i=0; i<n; ++i) ar & f[i];
+        }
+    }
+
+    /// Handle to the write of a checkpoint that proceeds in the background
+    class CheckpointHandle {
+        std::shared_ptr<detail::CheckpointJob> job;
+
+    public:
+        CheckpointHandle() {}
+
+        explicit CheckpointHandle(const std::shared_ptr<detail::CheckpointJob>& job) : job(job) {}
+
+        /// Returns true if this process has finished writing
+        bool probe() const {
+            return !job || job->done.load(std::memory_order_acquire);
+        }
+
+        /// Waits for this process to finish writing (running tasks meanwhile) ... throws if the write failed
+        void wait() const;
+
+        /// Waits for all processes to finish writing ... collective
+        void wait(World& world) const {
+            wait();
+            world.gop.fence();
+        }
+    };
+
+    /// Writes a checkpoint of a function, overlapping the write with computation
+
+    /// Collective.  Each process serializes its part of the tree into
+    /// memory and returns; a dedicated I/O thread per process then
+    /// (optionally) compresses the data and writes \c name.rank (through a
+    /// temporary file, so an earlier checkpoint of the same name stays
+    /// intact until the new one is complete).  \c f may be modified as soon as this
+    /// returns.  Call \c wait(world) on the handle before reading the checkpoint
+    /// and before \c finalize().
+    ///
+    /// Every process writes its own file so the checkpoint must be read by at
+    /// least as many processes as wrote it.  Uncompressed checkpoints are
+    /// ordinary parallel archives that \c load() can also read.
+    /// \param[in] compression See CheckpointCompression
+    /// \param[in] tol For lossy compression, the absolute error of a coefficient (default 0.01*thresh)
+    template <typename T, std::size_t NDIM>
+    CheckpointHandle save_async(const Function<T,NDIM>& f, const std::string name,
+                                CheckpointCompression compression=CheckpointCompression::None,
+                                double tol=0.0) {
+        std::shared_ptr<detail::CheckpointJob> job =
+            detail::checkpoint_snapshot(f.world(), std::vector< Function<T,NDIM> >(1,f), false, name, compression, tol);
+        detail::checkpoint_submit(job);
+        return CheckpointHandle(job);
+    }
+
+    /// Writes a checkpoint of a vector of functions, overlapping the write with computation
+
+    /// As save_async() for a single function; uncompressed checkpoints can also be read by load_function()
+    template <typename T, std::size_t NDIM>
+    CheckpointHandle save_async(const std::vector< Function<T,NDIM> >& f, const std::string name,
+                                CheckpointCompression compression=CheckpointCompression::None,
+                                double tol=0.0) {
+        MADNESS_CHECK(f.size() > 0);
+        std::shared_ptr<detail::CheckpointJob> job =
+            detail::checkpoint_snapshot(f.front().world(), f, true, name, compression, tol);
+        detail::checkpoint_submit(job);
+        return CheckpointHandle(job);
+    }
+
+    /// Reads a function written by save_async() or save() ... collective
+    template <typename T, std::size_t NDIM>
+    void load_checkpoint(World& world, Function<T,NDIM>& f, const std::string name) {
+        std::vector< Function<T,NDIM> > v;
+        detail::checkpoint_load(world, v, false, name);
+        f = v[0];
+    }
+
+    /// Reads a vector of functions written by save_async() or save_function() ... collective
+    template <typename T, std::size_t NDIM>
+    void load_checkpoint(World& world, std::vector< Function<T,NDIM> >& f, const std::string name) {
+        detail::checkpoint_load(world, f, true, name);
+    }
+
+}
+
+#endif // MADNESS_MRA_CHECKPOINT_H__INCLUDED
@@ -39,6 +39,7 @@
 #include <madness/mra/simplecache.h>
 #include <madness/mra/adquad.h>
 #include <madness/mra/twoscale.h>
+#include <madness/mra/convolution_cache.h>
 #include <madness/tensor/aligned.h>
 #include <madness/tensor/tensor_lapack.h>
 #include <algorithm>
@@ -172,6 +173,10 @@ namespace madness {
         double N_up, N_diff, N_F;               ///< the norms according to Beylkin 2008, Eq. (21) ff
 
 
+        /// default ctor for an empty object to be filled by load()
+        ConvolutionData1D() : Rnorm(0.0), Tnorm(0.0), Rnormf(0.0), Tnormf(0.0), NSnormf(0.0),
+                              N_up(0.0), N_diff(0.0), N_F(0.0) {}
+
         /// ctor for NS form
         /// make the operator matrices r^n and \uparrow r^(n-1)
         /// @param[in]  R   operator matrix of the requested level;     NS: unfilter(r^(n+1)); modified NS: r^n
@@ -191,6 +196,7 @@ namespace madness {
                     for (int j=0; j<k; ++j)
                         NS(i,j) = 0.0;
                 NSnormf = NS.normf();
+                N_F = N_up = N_diff = 0.0;
 
             }
             else {
@@ -246,6 +252,81 @@ namespace madness {
                 }
             }
         }
+
+        /// Append the data to a flat byte buffer (used by ConvolutionDiskCache)
+        void store(std::vector<unsigned char>& buf) const {
+            const double norms[8] = {Rnorm, Tnorm, Rnormf, Tnormf, NSnormf, N_up, N_diff, N_F};
+            append(buf, norms, sizeof(norms));
+            store_tensor(buf, R);
+            store_tensor(buf, T);
+            store_tensor(buf, RU);
+            store_tensor(buf, RVT);
+            store_tensor(buf, TU);
+            store_tensor(buf, TVT);
+            store_tensor(buf, Rs);
+            store_tensor(buf, Ts);
+        }
+
+        /// Restore the data written by store() ... returns false if the buffer is inconsistent
+
+        /// The tensors are copied since they cannot refer to the (mapped) buffer
+        bool load(const unsigned char* buf, std::size_t nbyte) {
+            const unsigned char* end = buf + nbyte;
+            double norms[8];
+            if (!extract(buf, end, norms, sizeof(norms))) return false;
+            Rnorm = norms[0]; Tnorm = norms[1]; Rnormf = norms[2]; Tnormf = norms[3];
+            NSnormf = norms[4]; N_up = norms[5]; N_diff = norms[6]; N_F = norms[7];
+            return load_tensor(buf, end, R) && load_tensor(buf, end, T)
+                && load_tensor(buf, end, RU) && load_tensor(buf, end, RVT)
+                && load_tensor(buf, end, TU) && load_tensor(buf, end, TVT)
+                && load_tensor(buf, end, Rs) && load_tensor(buf, end, Ts)
+                && buf == end;
+        }
+
+    private:
+        static void append(std::vector<unsigned char>& buf, const void* p, std::size_t nbyte) {
+            const unsigned char* c = static_cast<const unsigned char*>(p);
+            buf.insert(buf.end(), c, c+nbyte);
+        }
+
+        static bool extract(const unsigned char*& buf, const unsigned char* end, void* p, std::size_t nbyte) {
+            if (std::size_t(end - buf) < nbyte) return false;
+            std::memcpy(p, buf, nbyte);
+            buf += nbyte;
+            return true;
+        }
+
+        template <typename T>
+        static void store_tensor(std::vector<unsigned char>& buf, const Tensor<T>& t) {
+            const int64_t ndim = t.ndim();
+            append(buf, &ndim, sizeof(ndim));
+            for (long i=0; i<t.ndim(); ++i) {
+                const int64_t d = t.dim(i);
+                append(buf, &d, sizeof(d));
+            }
+            if (t.size()) {
+                const Tensor<T> c = t.iscontiguous() ? t : copy(t);
+                append(buf, c.ptr(), c.size()*sizeof(T));
+            }
+        }
+
+        template <typename T>
+        static bool load_tensor(const unsigned char*& buf, const unsigned char* end, Tensor<T>& t) {
+            int64_t ndim;
+            if (!extract(buf, end, &ndim, sizeof(ndim)) || ndim > TENSOR_MAXDIM) return false;
+            if (ndim < 1) {
+                t = Tensor<T>();
+                return true;
+            }
+            std::vector<long> dims(ndim);
+            for (long i=0; i<ndim; ++i) {
+                int64_t d;
+                if (!extract(buf, end, &d, sizeof(d)) || d < 0) return false;
+                dims[i] = d;
+            }
+            t = Tensor<T>(dims, false);
+            return extract(buf, end, t.ptr(), t.size()*sizeof(T));
+        }
     };
 
     /// Provides the common functionality/interface of all 1D convolutions
@@ -422,11 +503,31 @@ namespace madness {
             return mod_ns_cache.getptr(cache_key);
         }
 
+        /// Fill in the kernel part of the key for ConvolutionDiskCache ... false if the kernel cannot be cached
+        virtual bool get_cache_key(ConvolutionCacheKey& key) const {
+            return false;
+        }
+
         /// Returns a pointer to the cached make_nonstandard form of the operator
         const ConvolutionData1D<Q>* nonstandard(Level n, Translation lx) const {
             const ConvolutionData1D<Q>* p = ns_cache.getptr(n,lx);
             if (p) return p;
 
+            // Next try the persistent cache (if any)
+            ConvolutionCacheKey disk_key;
+            const bool use_disk_cache = ConvolutionDiskCache::enabled() && get_cache_key(disk_key);
+            if (use_disk_cache) {
+                disk_key.n = n;
+                disk_key.lx = lx;
+                std::size_t nbyte;
+                const unsigned char* buf = ConvolutionDiskCache::find(disk_key, nbyte);
+                ConvolutionData1D<Q> data;
+                if (buf && data.load(buf, nbyte)) {
+                    ns_cache.set(n,lx,data);
+                    return ns_cache.getptr(n,lx);
+                }
+            }
+
             // PROFILE_MEMBER_FUNC(Convolution1D); // Too fine grain for routine profiling
 
             Tensor<Q> R, T;
@@ -481,7 +582,13 @@ namespace madness {
                 //print("NS", n, lx, R.normf(), T.normf());
             }
 
-            ns_cache.set(n,lx,ConvolutionData1D<Q>(R,T));
+            ConvolutionData1D<Q> data(R,T);
+            if (use_disk_cache && R.size()) {
+                std::vector<unsigned char> buf;
+                data.store(buf);
+                ConvolutionDiskCache::record(disk_key, buf);
+            }
+            ns_cache.set(n,lx,data);
 
             return ns_cache.getptr(n,lx);
         };
@@ -720,6 +827,19 @@ namespace madness {
             return natlev;
         }
 
+        virtual bool get_cache_key(ConvolutionCacheKey& key) const {
+            key.qtype = TensorTypeData<Q>::id;
+            key.kernel = ConvolutionCacheKey::Gaussian;
+            key.k = this->k;
+            key.m = m;
+            key.maxR = Convolution1D<Q>::maxR;
+            key.expnt = expnt;
+            key.coeff[0] = std::real(coeff);
+            key.coeff[1] = std::imag(coeff);
+            key.arg = this->arg;
+            return true;
+        }
+
         /// Compute the projection of the operator onto the double order polynomials
 
         /// The returned reference is to a cached tensor ... if you want to
@@ -0,0 +1,266 @@
+/*
+  This file is part of MADNESS.
+
+  Copyright (C) 2007,2010 Oak Ridge National Laboratory
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+
+  For more information please contact:
+
+  Robert J. Harrison
+  Oak Ridge National Laboratory
+  One Bethel Valley Road
+  P.O. Box 2008, MS-6367
+
+  email: harrisonrj@ornl.gov
+  tel:   865-241-3937
+  fax:   865-572-0680
+
+  $Id$
+*/
+
+/// \file mra/convolution_cache.cc
+/// \brief Implements ConvolutionDiskCache
+
+#include <madness/mra/convolution_cache.h>
+#include <madness/world/MADworld.h>
+#include <madness/world/print.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace madness {
+
+    namespace {
+
+        // File layout: Header, nentry IndexEntry, then the data of each
+        // entry at its offset (8-byte aligned) from the start of the file
+        const char cache_magic[8] = {'M','A','D','C','O','N','V','\0'};
+        const uint32_t cache_version = 1;
+
+        struct Header {
+            char magic[8];
+            uint32_t version;
+            uint32_t keysize;
+            uint64_t nentry;
+        };
+
+        struct IndexEntry {
+            ConvolutionCacheKey key;
+            uint64_t offset;
+            uint64_t nbyte;
+        };
+
+        typedef std::map< std::string, std::pair<const unsigned char*, std::size_t> > indexT;
+
+        std::string key_string(const ConvolutionCacheKey& key) {
+            return std::string(reinterpret_cast<const char*>(&key), sizeof(key));
+        }
+
+        /// A read-only shared mapping of a cache file
+        class MappedFile {
+            void* base;
+            std::size_t size;
+
+        public:
+            explicit MappedFile(const std::string& filename) : base(0), size(0) {
+                int fd = open(filename.c_str(), O_RDONLY);
+                if (fd < 0) return;
+                struct stat st;
+                if (fstat(fd, &st) == 0 && st.st_size > 0) {
+                    void* p = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+                    if (p != MAP_FAILED) {
+                        base = p;
+                        size = st.st_size;
+                    }
+                }
+                close(fd);
+            }
+
+            ~MappedFile() {
+                if (base) munmap(base, size);
+            }
+
+            /// Add the entries to index (existing keys are kept); returns false if the file is not a valid cache
+            bool read_index(indexT& index) const {
+                if (!base || size < sizeof(Header)) return false;
+                const unsigned char* p = static_cast<const unsigned char*>(base);
+                const Header* h = reinterpret_cast<const Header*>(p);
+                if (std::memcmp(h->magic, cache_magic, sizeof(cache_magic)) ||
+                    h->version != cache_version || h->keysize != sizeof(ConvolutionCacheKey) ||
+                    sizeof(Header) + h->nentry*sizeof(IndexEntry) > size) return false;
+                const IndexEntry* entries = reinterpret_cast<const IndexEntry*>(p + sizeof(Header));
+                for (uint64_t i=0; i<h->nentry; ++i) {
+                    if (entries[i].offset + entries[i].nbyte > size) return false;
+                }
+                for (uint64_t i=0; i<h->nentry; ++i) {
+                    index.insert(std::make_pair(key_string(entries[i].key),
+                                                std::make_pair(p + entries[i].offset, std::size_t(entries[i].nbyte))));
+                }
+                return true;
+            }
+        };
+
+        void write_cache_file(const std::string& filename, const indexT& index) {
+            std::ofstream f(filename.c_str(), std::ios::binary | std::ios::trunc);
+            if (!f) MADNESS_EXCEPTION("ConvolutionDiskCache: failed to open file for writing", 0);
+
+            Header h;
+            std::memcpy(h.magic, cache_magic, sizeof(cache_magic));
+            h.version = cache_version;
+            h.keysize = sizeof(ConvolutionCacheKey);
+            h.nentry = index.size();
+            f.write(reinterpret_cast<const char*>(&h), sizeof(h));
+
+            uint64_t offset = sizeof(Header) + index.size()*sizeof(IndexEntry);
+            for (indexT::const_iterator it=index.begin(); it!=index.end(); ++it) {
+                IndexEntry e;
+                std::memcpy(&e.key, it->first.data(), sizeof(ConvolutionCacheKey));
+                e.offset = offset;
+                e.nbyte = it->second.second;
+                f.write(reinterpret_cast<const char*>(&e), sizeof(e));
+                offset += (e.nbyte + 7) & ~uint64_t(7);
+            }
+
+            const char zeros[8] = {0};
+            for (indexT::const_iterator it=index.begin(); it!=index.end(); ++it) {
+                const std::size_t nbyte = it->second.second;
+                f.write(reinterpret_cast<const char*>(it->second.first), nbyte);
+                f.write(zeros, ((nbyte + 7) & ~std::size_t(7)) - nbyte);
+            }
+            if (!f) MADNESS_EXCEPTION("ConvolutionDiskCache: failed to write file", 0);
+        }
+
+        struct CacheState {
+            std::string filename;
+            std::unique_ptr<MappedFile> file;  // The mapping lives as long as the program
+            indexT index;                      // Entries of the mapped file ... not modified after initialize
+            std::map< std::string, std::vector<unsigned char> > pending; // Computed in this run
+            Mutex mutex;
+            unsigned long nhit, nmiss;
+
+            CacheState() : nhit(0), nmiss(0) {}
+        };
+
+        // Never destroyed so that the mapped data outlive all operators
+        CacheState& cache_state() {
+            static CacheState* s = new CacheState;
+            return *s;
+        }
+
+    }  // namespace
+
+
+    void ConvolutionDiskCache::initialize(World& world) {
+        const char* filename = getenv("MAD_OPERATOR_CACHE");
+        if (!filename || !*filename) return;
+
+        CacheState& s = cache_state();
+        ScopedMutex<Mutex> lock(s.mutex);
+        if (s.filename == filename) return;   // Already initialized (startup called again)
+        s.filename = filename;
+        s.index.clear();
+        s.file.reset(new MappedFile(s.filename));
+        if (!s.file->read_index(s.index)) {
+            s.index.clear();
+            if (world.rank() == 0 && access(filename, F_OK) == 0)
+                print("ConvolutionDiskCache: ignoring invalid or incompatible cache file", s.filename);
+        }
+        if (world.rank() == 0)
+            print("ConvolutionDiskCache: mapped", s.index.size(), "operator blocks from", s.filename);
+    }
+
+
+    bool ConvolutionDiskCache::enabled() {
+        return !cache_state().filename.empty();
+    }
+
+
+    const unsigned char* ConvolutionDiskCache::find(const ConvolutionCacheKey& key, std::size_t& nbyte) {
+        CacheState& s = cache_state();
+        indexT::const_iterator it = s.index.find(key_string(key));
+        ScopedMutex<Mutex> lock(s.mutex);
+        if (it == s.index.end()) {
+            s.nmiss++;
+            return 0;
+        }
+        s.nhit++;
+        nbyte = it->second.second;
+        return it->second.first;
+    }
+
+
+    void ConvolutionDiskCache::record(const ConvolutionCacheKey& key, const std::vector<unsigned char>& data) {
+        CacheState& s = cache_state();
+        ScopedMutex<Mutex> lock(s.mutex);
+        s.pending.insert(std::make_pair(key_string(key), data));
+    }
+
+
+    void ConvolutionDiskCache::save(World& world) {
+        if (!enabled()) return;
+        CacheState& s = cache_state();
+
+        // Every process writes what it computed to a part file that
+        // process 0 merges into the cache file
+        world.gop.fence();
+        const std::string prefix = s.filename + ".part";
+        unsigned long nnew = 0;
+        {
+            ScopedMutex<Mutex> lock(s.mutex);
+            if (s.pending.size()) {
+                indexT pending;
+                for (const auto& p : s.pending) {
+                    pending.insert(std::make_pair(p.first, std::make_pair(p.second.data(), p.second.size())));
+                }
+                write_cache_file(prefix + std::to_string(world.rank()), pending);
+                s.pending.clear();
+            }
+        }
+        world.gop.fence();
+
+        if (world.rank() == 0) {
+            indexT merged = s.index;
+            std::vector< std::unique_ptr<MappedFile> > parts;
+            for (ProcessID p=0; p<world.size(); ++p) {
+                const std::string partname = prefix + std::to_string(p);
+                if (access(partname.c_str(), F_OK) != 0) continue;
+                parts.emplace_back(new MappedFile(partname));
+                const std::size_t nold = merged.size();
+                parts.back()->read_index(merged);
+                nnew += merged.size() - nold;
+            }
+            const std::string tmpname = s.filename + ".tmp";
+            write_cache_file(tmpname, merged);
+            if (std::rename(tmpname.c_str(), s.filename.c_str()))
+                MADNESS_EXCEPTION("ConvolutionDiskCache: failed to rename cache file", 0);
+            parts.clear();
+            for (ProcessID p=0; p<world.size(); ++p) std::remove((prefix + std::to_string(p)).c_str());
+
+            print("ConvolutionDiskCache: wrote", merged.size(), "operator blocks (", nnew, "new,",
+                  s.nhit, "hits and", s.nmiss, "misses on process 0 ) to", s.filename);
+        }
+        world.gop.fence();
+    }
+
+}
@@ -0,0 +1,108 @@
+/*
+  This file is part of MADNESS.
+
+  Copyright (C) 2007,2010 Oak Ridge National Laboratory
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+
+  For more information please contact:
+
+  Robert J. Harrison
+  Oak Ridge National Laboratory
+  One Bethel Valley Road
+  P.O. Box 2008, MS-6367
+
+  email: harrisonrj@ornl.gov
+  tel:   865-241-3937
+  fax:   865-572-0680
+
+  $Id$
+*/
+#ifndef MADNESS_MRA_CONVOLUTION_CACHE_H__INCLUDED
+#define MADNESS_MRA_CONVOLUTION_CACHE_H__INCLUDED
+
+/// \file mra/convolution_cache.h
+/// \brief Persistent on-disk cache of the 1D operator data of convolutions
+
+#include <madness/madness_config.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace madness {
+
+    class World;
+
+    /// Identifies the nonstandard-form data of one 1D convolution kernel at one level and translation
+
+    /// All members are 8-byte aligned so there is no padding and keys can be
+    /// compared bytewise.
+    struct ConvolutionCacheKey {
+        int32_t qtype;      ///< TensorTypeData<Q>::id of the operator
+        int32_t kernel;     ///< Kind of kernel (see Kernel)
+        int32_t k;          ///< Wavelet order
+        int32_t m;          ///< Order of derivative
+        int32_t maxR;       ///< Number of lattice translations for periodic sums
+        int32_t n;          ///< Level
+        int64_t lx;         ///< Translation
+        double expnt;       ///< Exponent
+        double coeff[2];    ///< Real and imaginary part of the coefficient
+        double arg;         ///< Bloch phase
+
+        enum Kernel {Gaussian=1};
+
+        ConvolutionCacheKey() {
+            std::memset(this, 0, sizeof(ConvolutionCacheKey));
+        }
+    };
+
+    /// Persistent, memory-mapped cache of the 1D transformation matrices of convolutions
+
+    /// Making the nonstandard form of a 1D kernel (the projection, the
+    /// two-scale transformation and the SVD in ConvolutionData1D) is a large
+    /// part of the setup of a SeparatedConvolution and is repeated in every
+    /// run and in every subworld.  If the environment variable
+    /// \c MAD_OPERATOR_CACHE names a file, \c startup() maps it read-only and
+    /// Convolution1D::nonstandard looks up blocks there before computing them.
+    /// Because the file is mapped shared, the processes on one node share the
+    /// same physical pages.  Newly computed blocks are kept in memory and
+    /// written by \c save(), which merges the contributions of all processes
+    /// (the file must be on a filesystem visible to all of them).
+    ///
+    /// The data do not depend on the truncation threshold, which is only used
+    /// when the operator is applied, so the threshold is not part of the key.
+    class ConvolutionDiskCache {
+    public:
+        /// Map the cache file named by \c MAD_OPERATOR_CACHE (if any); called by \c startup()
+        static void initialize(World& world);
+
+        /// True if a cache file is configured
+        static bool enabled();
+
+        /// Return pointer to the stored data of \c key and set \c nbyte, or null if not present
+        static const unsigned char* find(const ConvolutionCacheKey& key, std::size_t& nbyte);
+
+        /// Remember newly computed data for the next \c save()
+        static void record(const ConvolutionCacheKey& key, const std::vector<unsigned char>& data);
+
+        /// Write the cache file including the data computed by all processes ... collective
+        static void save(World& world);
+    };
+
+}
+
+#endif // MADNESS_MRA_CONVOLUTION_CACHE_H__INCLUDED
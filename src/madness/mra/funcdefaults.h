@@ -197,6 +197,7 @@ namespace madness {
         static bool autorefine;        ///< Whether to autorefine in multiplication, etc.
         static bool debug;             ///< Controls output of debug info
         static bool truncate_on_project; ///< If true initial projection inserts at n-1 not n
+        static double low_precision_tol; ///< Nodes with a smaller norm are kept in single precision after truncation (0 disables)
         static bool apply_randomize;   ///< If true use randomization for load balancing in apply integral operator
         static bool project_randomize; ///< If true use randomization for load balancing in project/refine
         static BoundaryConditions<NDIM> bc; ///< Default boundary conditions
@@ -351,6 +352,20 @@ namespace madness {
         	truncate_on_project=value;
         }
 
+        /// Gets the default tolerance for single precision storage of coefficients
+        static double get_low_precision_tol() {
+        	return low_precision_tol;
+        }
+
+        /// Sets the default tolerance for single precision storage of coefficients
+
+        /// After truncation the coefficients of nodes with norm below
+        /// this value are stored in single precision with a scale factor.
+        /// Zero (the default) disables single precision storage.
+        static void set_low_precision_tol(double value) {
+        	low_precision_tol=value;
+        }
+
         /// Gets the random load balancing for integral operators flag
         static bool get_apply_randomize() {
         	return apply_randomize;
@@ -37,6 +37,12 @@
 
 #include <iostream>
 #include <type_traits>
+#include <map>
+#include <algorithm>
+#include <atomic>
+#include <complex>
+#include <cstdint>
+#include <cstring>
 #include <madness/world/MADworld.h>
 #include <madness/world/print.h>
 #include <madness/misc/misc.h>
@@ -119,12 +125,31 @@ namespace madness {
     };
 
 
+    namespace detail {
+
+        /// The single precision type used to store the coefficients of demoted nodes
+        template <typename T> struct low_precision { typedef float type; };
+        template <typename T> struct low_precision< std::complex<T> > { typedef std::complex<float> type; };
+
+        /// Lock serializing the promotion of demoted nodes ... striped by address
+        inline Spinlock& function_node_lock(const void* p) {
+            static Spinlock locks[64];
+            return locks[(reinterpret_cast<std::uintptr_t>(p) >> 6) & 63];
+        }
+
+    }
+
     /// FunctionNode holds the coefficients, etc., at each node of the 2^NDIM-tree
+
+    /// Nodes whose coefficients are small (see demote()) may keep them in
+    /// single precision with a scale factor.  They are promoted back to
+    /// full precision, permanently, the first time coeff() is accessed.
     template<typename T, std::size_t NDIM>
     class FunctionNode {
     public:
     	typedef GenTensor<T> coeffT;
     	typedef Tensor<T> tensorT;
+        typedef Tensor<typename detail::low_precision<T>::type> lowtensorT;
     private:
         // Should compile OK with these volatile but there should
         // be no need to set as volatile since the container internally
@@ -135,6 +160,21 @@ namespace madness {
         bool _has_children; ///< True if there are children
         coeffT buffer; ///< The coefficients, if any
         double dnorm=-1.0;	///< norm of the d coefficients
+        lowtensorT _lowcoeffs;  ///< The coefficients divided by _lowscale if demoted
+        double _lowscale=0.0;   ///< Norm of the coefficients if demoted
+        mutable std::atomic<bool> _demoted{false}; ///< True if the coefficients are in _lowcoeffs
+
+        /// Moves demoted coefficients back into _coeffs
+        void promote() const {
+            ScopedMutex<Spinlock> lock(detail::function_node_lock(this));
+            if (!_demoted.load(std::memory_order_relaxed)) return;
+            FunctionNode<T,NDIM>* self = const_cast<FunctionNode<T,NDIM>*>(this);
+            tensorT c = madness::convert<T>(_lowcoeffs);
+            c.scale(_lowscale);
+            self->_coeffs = coeffT(c,-1.0,TT_FULL);
+            self->_lowcoeffs = lowtensorT();
+            _demoted.store(false, std::memory_order_release);
+        }
 
     public:
         typedef WorldContainer<Key<NDIM> , FunctionNode<T, NDIM> > dcT; ///< Type of container holding the nodes
@@ -165,7 +205,19 @@ namespace madness {
         FunctionNode<T, NDIM>&
         operator=(const FunctionNode<T, NDIM>& other) {
             if (this != &other) {
-                coeff() = copy(other.coeff());
+                // copy demoted coefficients as they are
+                bool demoted = false;
+                if (other.is_demoted()) {
+                    ScopedMutex<Spinlock> lock(detail::function_node_lock(&other));
+                    if (other.is_demoted()) {
+                        if (is_demoted()) promote();
+                        _coeffs = coeffT();
+                        _lowcoeffs = copy(other._lowcoeffs);
+                        _lowscale = other._lowscale;
+                        _demoted = demoted = true;
+                    }
+                }
+                if (!demoted) coeff() = copy(other.coeff());
                 _norm_tree = other._norm_tree;
                 _has_children = other._has_children;
                 dnorm=other.dnorm;
@@ -186,7 +238,48 @@ namespace madness {
         /// Returns true if there are coefficients in this node
         bool
         has_coeff() const {
-            return _coeffs.has_data();
+            return is_demoted() || _coeffs.has_data();
+        }
+
+        /// Returns true if the coefficients are currently stored in single precision
+        bool
+        is_demoted() const {
+            return _demoted.load(std::memory_order_acquire);
+        }
+
+        /// Stores full-rank coefficients with norm below \c tol in single precision
+
+        /// The coefficients are divided by their norm so that the scale
+        /// of tiny coefficients does not matter.  Must not be called
+        /// concurrently with other accesses to this node.
+        /// \return true if the node was demoted
+        bool demote(double tol) {
+            if (is_demoted() || !_coeffs.has_data() || !_coeffs.is_full_tensor()) return false;
+            const double norm = _coeffs.normf();
+            if (norm >= tol) return false;
+            _lowscale = norm;
+            tensorT c = _coeffs.full_tensor();
+            _lowcoeffs = (norm > 0.0) ? madness::convert<typename lowtensorT::type>(c*(1.0/norm))
+                                      : madness::convert<typename lowtensorT::type>(c);
+            _coeffs = coeffT();
+            _demoted = true;
+            return true;
+        }
+
+        /// Returns the norm of the coefficients without promoting demoted ones
+        double normf() const {
+            if (is_demoted()) {
+                ScopedMutex<Spinlock> lock(detail::function_node_lock(this));
+                if (is_demoted()) return _lowscale*_lowcoeffs.normf();
+            }
+            return _coeffs.normf();
+        }
+
+        /// Returns the number of bytes saved by keeping the coefficients in single precision
+        std::size_t low_precision_savings() const {
+            if (!is_demoted()) return 0;
+            ScopedMutex<Spinlock> lock(detail::function_node_lock(this));
+            return _lowcoeffs.size()*(sizeof(T) - sizeof(typename lowtensorT::type));
         }
 
 
@@ -213,6 +306,7 @@ namespace madness {
         /// Returns an empty tensor if there are no coefficients.
         coeffT&
         coeff() {
+            if (is_demoted()) promote();
             MADNESS_ASSERT(_coeffs.ndim() == -1 || (_coeffs.dim(0) <= 2
                                                     * MAXK && _coeffs.dim(0) >= 0));
             return const_cast<coeffT&>(_coeffs);
@@ -223,11 +317,16 @@ namespace madness {
         /// Returns an empty tensor if there are no coefficeints.
         const coeffT&
         coeff() const {
+            if (is_demoted()) promote();
             return const_cast<const coeffT&>(_coeffs);
         }
 
         /// Returns the number of coefficients in this node
         size_t size() const {
+            if (is_demoted()) {
+                ScopedMutex<Spinlock> lock(detail::function_node_lock(this));
+                if (is_demoted()) return _lowcoeffs.size();
+            }
             return _coeffs.size();
         }
 
@@ -235,7 +334,7 @@ namespace madness {
 
         /// reduces the rank of the coefficients (if applicable)
         void reduceRank(const double& eps) {
-            _coeffs.reduce_rank(eps);
+            coeff().reduce_rank(eps);
         }
 
         /// Sets \c has_children attribute to value of \c flag.
@@ -287,7 +386,7 @@ namespace madness {
         /// Scale the coefficients of this node
         template <typename Q>
         void scale(Q a) {
-            _coeffs.scale(a);
+            coeff().scale(a);
         }
 
         /// Sets the value of norm_tree
@@ -406,7 +505,7 @@ namespace madness {
         }
 
         T trace_conj(const FunctionNode<T,NDIM>& rhs) const {
-            return this->_coeffs.trace_conj((rhs._coeffs));
+            return this->coeff().trace_conj((rhs.coeff()));
         }
 
         template <typename Archive>
@@ -2105,6 +2204,31 @@ namespace madness {
 
         };
 
+        /// store the coefficients of nodes with small norm in single precision
+        struct do_demote {
+            typedef Range<typename dcT::iterator> rangeT;
+            double tol;
+
+            do_demote() : tol(0.0) {}
+            do_demote(double tol) : tol(tol) {}
+
+            bool operator()(typename rangeT::iterator& it) const {
+                it->second.demote(tol);
+                return true;
+            }
+            template <typename Archive> void serialize(const Archive& ar) {
+                ar & tol;
+            }
+        };
+
+        /// Keeps the coefficients of nodes with norm below \c tol in single precision, optional fence
+
+        /// Demoted nodes are transparently promoted back on access.
+        /// No other operation may be in progress on this function.
+        void demote(double tol, bool fence) {
+            if (tol > 0.0) flo_unary_op_node_inplace(do_demote(tol),fence);
+        }
+
 
         /// keep only the sum coefficients in each node
         struct do_keep_sum_coeffs {
@@ -2592,26 +2716,94 @@ namespace madness {
             coeffs.replace(key, nodeT(coeffT(values2coeffs(key, r),targs),false));
         }
 
+        /// Gather the values of many boxes of many functions into contiguous tensors
+
+        /// The boxes are stacked along the first dimension, i.e. the result for
+        /// function i has the dimensions (keys.size()*k, k, ...)
+        /// @param[in] keys the keys of the boxes
+        /// @param[in] v the vector of function impl's, null pointers yield empty tensors
+        std::vector<tensorT> gather_values(const std::vector<keyT>& keys,
+                const std::vector<implT*>& v) const {
+            std::vector<long> dims(cdata.vk.begin(),cdata.vk.end());
+            dims[0]*=keys.size();
+            long npt=1;
+            for (long d : cdata.vk) npt*=d;
+            std::vector<tensorT> c(v.size());
+            for (unsigned int i=0; i<v.size(); i++) {
+                if (not v[i]) continue;
+                c[i]=tensorT(dims,false);
+                for (std::size_t ib=0; ib<keys.size(); ++ib) {
+                    const tensorT values=coeffs2values(keys[ib],
+                            v[i]->coeffs.find(keys[ib]).get()->second.coeff()).full_tensor();
+                    MADNESS_ASSERT(values.size()==npt);
+                    std::copy(values.ptr(),values.ptr()+npt,c[i].ptr()+ib*npt);
+                }
+            }
+            return c;
+        }
+
+        /// Scatter values stacked by gather_values back into boxes of the function impl
+
+        /// @param[in] keys the keys of the boxes
+        /// @param[in] r values of all boxes as returned by gather_values
+        void scatter_values(const std::vector<keyT>& keys, const tensorT& r) {
+            const long npt=r.size()/keys.size();
+            for (std::size_t ib=0; ib<keys.size(); ++ib) {
+                tensorT values(cdata.vk,false);
+                MADNESS_ASSERT(values.size()==npt);
+                std::copy(r.ptr()+ib*npt,r.ptr()+(ib+1)*npt,values.ptr());
+                coeffs.replace(keys[ib], nodeT(coeffT(values2coeffs(keys[ib], values),targs),false));
+            }
+        }
+
+        /// Inplace operate on many functions (impl's) with an operator on a batch of boxes
+
+        /// The values of all boxes are passed to the operator in one call, see
+        /// gather_values, so the operator must act pointwise; it is passed the
+        /// first key of the batch.
+        /// @param[in] keys the keys of the boxes
+        /// @param[in] op the operator
+        /// @param[in] v the vector of function impl's on which to be operated
+        template <typename opT>
+        void multiop_values_batch_doit(const std::vector<keyT>& keys, const opT& op,
+                const std::vector<implT*>& v) {
+            const std::vector<tensorT> c=gather_values(keys,v);
+            scatter_values(keys,op(keys.front(), c));
+        }
+
         /// Inplace operate on many functions (impl's) with an operator within a certain box
         /// Assumes all functions have been refined down to the same level
         /// @param[in] op the operator
         /// @param[in] v the vector of function impl's on which to be operated
+        /// @param[in] batchsize if larger than 1 op is applied to that many boxes
+        ///             at once, see multiop_values_batch_doit
         template <typename opT>
-        void multiop_values(const opT& op, const std::vector<implT*>& v) {
+        void multiop_values(const opT& op, const std::vector<implT*>& v,
+                const std::size_t batchsize=1) {
             // rough check on refinement level (ignore non-initialized functions
             for (std::size_t i=1; i<v.size(); ++i) {
                 if (v[i] and v[i-1]) {
                     MADNESS_ASSERT(v[i]->coeffs.size()==v[i-1]->coeffs.size());
                 }
             }
+            std::vector<keyT> batch;
             typename dcT::iterator end = v[0]->coeffs.end();
             for (typename dcT::iterator it=v[0]->coeffs.begin(); it!=end; ++it) {
                 const keyT& key = it->first;
-                if (it->second.has_coeff())
-                    world.taskq.add(*this, &implT:: template multiop_values_doit<opT>, key, op, v);
-                else
+                if (not it->second.has_coeff())
                     coeffs.replace(key, nodeT(coeffT(),true));
+                else if (batchsize<=1)
+                    world.taskq.add(*this, &implT:: template multiop_values_doit<opT>, key, op, v);
+                else {
+                    batch.push_back(key);
+                    if (batch.size()==batchsize) {
+                        world.taskq.add(*this, &implT:: template multiop_values_batch_doit<opT>, batch, op, v);
+                        batch.clear();
+                    }
+                }
             }
+            if (batch.size()>0)
+                world.taskq.add(*this, &implT:: template multiop_values_batch_doit<opT>, batch, op, v);
             world.gop.fence();
         }
 
@@ -2638,34 +2830,64 @@ namespace madness {
             }
         }
 
+        /// Inplace operate on many functions (impl's) with an operator on a batch of boxes
+
+        /// The operator must act pointwise, see multiop_values_batch_doit
+        /// @param[in] keys the keys of the boxes
+        /// @param[in] op the operator
+        /// @param[in] vin the vector of function impl's on which to be operated
+        /// @param[out] vout the resulting vector of function impl's
+        template <typename opT>
+        void multi_to_multi_op_values_batch_doit(const std::vector<keyT>& keys, const opT& op,
+                const std::vector<implT*>& vin, std::vector<implT*>& vout) {
+            const std::vector<tensorT> c=gather_values(keys,vin);
+            std::vector<tensorT> r = op(keys.front(), c);
+            MADNESS_ASSERT(r.size()==vout.size());
+            for (std::size_t i=0; i<vout.size(); ++i) vout[i]->scatter_values(keys,r[i]);
+        }
+
         /// Inplace operate on many functions (impl's) with an operator within a certain box
 
         /// Assumes all functions have been refined down to the same level
         /// @param[in] op the operator
         /// @param[in] vin the vector of function impl's on which to be operated
         /// @param[out] vout the resulting vector of function impl's
+        /// @param[in] batchsize if larger than 1 op is applied to that many boxes
+        ///             at once, see multi_to_multi_op_values_batch_doit
         template <typename opT>
         void multi_to_multi_op_values(const opT& op, const std::vector<implT*>& vin,
-                std::vector<implT*>& vout, const bool fence=true) {
+                std::vector<implT*>& vout, const bool fence=true, const std::size_t batchsize=1) {
             // rough check on refinement level (ignore non-initialized functions
             for (std::size_t i=1; i<vin.size(); ++i) {
                 if (vin[i] and vin[i-1]) {
                     MADNESS_ASSERT(vin[i]->coeffs.size()==vin[i-1]->coeffs.size());
                 }
             }
+            std::vector<keyT> batch;
             typename dcT::iterator end = vin[0]->coeffs.end();
             for (typename dcT::iterator it=vin[0]->coeffs.begin(); it!=end; ++it) {
                 const keyT& key = it->first;
-                if (it->second.has_coeff())
-                    world.taskq.add(*this, &implT:: template multi_to_multi_op_values_doit<opT>,
-                            key, op, vin, vout);
-                else {
+                if (not it->second.has_coeff()) {
                     // fill result functions with empty box in this key
                     for (implT* it2 : vout) {
                         it2->coeffs.replace(key, nodeT(coeffT(),true));
                     }
                 }
+                else if (batchsize<=1)
+                    world.taskq.add(*this, &implT:: template multi_to_multi_op_values_doit<opT>,
+                            key, op, vin, vout);
+                else {
+                    batch.push_back(key);
+                    if (batch.size()==batchsize) {
+                        world.taskq.add(*this, &implT:: template multi_to_multi_op_values_batch_doit<opT>,
+                                batch, op, vin, vout);
+                        batch.clear();
+                    }
+                }
             }
+            if (batch.size()>0)
+                world.taskq.add(*this, &implT:: template multi_to_multi_op_values_batch_doit<opT>,
+                        batch, op, vin, vout);
             if (fence) world.gop.fence();
         }
 
@@ -4252,6 +4474,17 @@ namespace madness {
         /// @param[in]  targs   target tensor arguments (threshold and full/low rank)
         void reduce_rank(const double thresh, bool fence);
 
+        /// reduce the rank of the coefficient tensors of several functions
+
+        /// The low-rank coefficients of the local nodes of all functions are
+        /// sorted by threshold and rank, and reduced in batches of equal shape
+        /// (see SVDTensor::reduce_rank_batched), one task per batch.
+        /// @param[in]  impls   the functions with their thresholds
+        static void reduce_rank(const std::vector<std::pair<implT*,double> >& impls, bool fence);
+
+        /// reduce the rank of a batch of coefficient tensors, see reduce_rank
+        static void reduce_rank_batch(const std::vector<coeffT*>& batch, const double thresh);
+
         T eval_cube(Level n, coordT& x, const tensorT& c) const;
 
         /// Transform sum coefficients at level n to sums+differences at level n-1
@@ -4403,6 +4636,40 @@ namespace madness {
         Future<coeffT > compress_spawn(const keyT& key, bool nonstandard, bool keepleaves,
         		bool redundant1);
 
+        /// Compresses the reconstructed functions in \c v together (cf compress)
+
+        /// All functions are visited in one traversal: each box is handled
+        /// by a single task for all functions present there, the two-scale
+        /// transforms are done as one stacked matrix product and the child
+        /// boxes receive one message for all functions.  The functions must
+        /// be distinct, full rank, and share the process map and wavelet order.
+        static void compress_vector(const std::vector<implT*>& v, bool fence);
+
+        /// Reconstructs the compressed functions in \c v together (cf reconstruct and compress_vector)
+        static void reconstruct_vector(const std::vector<implT*>& v, bool fence);
+
+        /// Applies the two-scale transform \c c to all columns of \c s at once
+
+        /// The rows of \c s are the coefficients of a box at level n (size
+        /// of \c cdata.v2k) and its columns the functions, i.e. each
+        /// dimension is one matrix product over all functions.  Returns the
+        /// transformed coefficients of function \c i in row \c i.
+        tensorT transform_columns(const tensorT& s, const Tensor<double>& c) const;
+
+        // Invoked on node where key is local
+        Future< std::vector<coeffT> > compress_spawn_vector(const std::vector<implT*>& v, const keyT& key);
+
+        /// Calculates the wavelet coefficients of the functions in \c v at \c key (cf compress_op)
+
+        /// @param[in] sums     sum coefficients of the functions that are leaves at \c key
+        /// @param[in] c        sum coefficients of the refined functions in each child box
+        /// @return             the sum coefficients of all functions in \c v
+        std::vector<coeffT> compress_op_vector(const std::vector<implT*>& v, const keyT& key,
+                const std::vector<coeffT>& sums, const std::vector< Future< std::vector<coeffT> > >& c);
+
+        // Invoked on node where key is local (cf reconstruct_op)
+        void reconstruct_op_vector(const std::vector<implT*>& v, const keyT& key, const std::vector<coeffT>& s);
+
         /// convert this to redundant, i.e. have sum coefficients on all levels
         void make_redundant(const bool fence);
 
@@ -4649,46 +4916,101 @@ namespace madness {
 
             double cnorm = c.normf();
 
+            double tol = truncate_tol(thresh, key);
+
             const std::vector<opkeyT>& disp = op->get_disp(key.level()); // list of displacements sorted in orer of increasing distance
             const std::vector<bool> is_periodic(NDIM,false); // Periodic sum is already done when making rnlp
-	    int ndone=1;	// Counts #done at each distance
-	    uint64_t distsq = 99999999999999; 
-            for (typename std::vector<opkeyT>::const_iterator it=disp.begin(); it != disp.end(); ++it) {
-	        keyT d;
-                Key<NDIM-opdim> nullkey(key.level());
-                if (op->particle()==1) d=it->merge_with(nullkey);
-                if (op->particle()==2) d=nullkey.merge_with(*it);
-
-		uint64_t dsq = d.distsq();
-		if (dsq != distsq) { // Moved to next shell of neighbors
-		    if (ndone == 0 && dsq > 1) {
-		        // Have at least done the input box and all first
-		        // nearest neighbors, and for all of the last set
-		        // of neighbors had no contribution.  Thus,
-		        // assuming monotonic decrease, we are done.
-		        break;
-		    }
-		    ndone = 0;
-		    distsq = dsq;
-		} 
-
-                keyT dest = neighbor(key, d, is_periodic);
-                if (dest.is_valid()) {
-                    double opnorm = op->norm(key.level(), *it, source);
-                    double tol = truncate_tol(thresh, key);
+            std::vector<opkeyT> shifts;         // Displacements that survive screening ...
+            std::vector<keyT> dests;            // ... and the boxes they contribute to
 
-                    if (cnorm*opnorm> tol/fac) {
-		        ndone++;
-		        tensorT result = op->apply(source, *it, c, tol/fac/cnorm);
-			if (result.normf() > 0.3*tol/fac) {
-			  if (coeffs.is_local(dest))
-			      coeffs.send(dest, &nodeT::accumulate2, result, coeffs, dest);
-			  else
-  			      coeffs.task(dest, &nodeT::accumulate2, result, coeffs, dest);
+            if (cnorm == 0.0) {
+                op->add_screening_stats(0, disp.size());
+                return;
+            }
+
+            // Screen against the operator's table of displacement norms
+            // for this level, which is sorted by decreasing norm so the
+            // first displacement that fails ends the loop
+            const double cutoff = tol/fac/cnorm;
+            std::shared_ptr<const typename opT::DisplacementNorms> table = op->get_disp_norms(key.level(), cutoff);
+            if (table) {
+                const Key<NDIM-opdim> nullkey(key.level());
+                for (typename std::vector< std::pair<opkeyT,double> >::const_iterator it=table->disp.begin();
+                     it != table->disp.end() && it->second > cutoff; ++it) {
+                    keyT d;
+                    if (op->particle()==1) d=it->first.merge_with(nullkey);
+                    if (op->particle()==2) d=nullkey.merge_with(it->first);
+                    keyT dest = neighbor(key, d, is_periodic);
+                    if (dest.is_valid()) {
+                        shifts.push_back(it->first);
+                        dests.push_back(dest);
+                    }
+                }
+            }
+            else {
+                int ndone=1;        // Counts #done at each distance
+                uint64_t distsq = 99999999999999; 
+                for (typename std::vector<opkeyT>::const_iterator it=disp.begin(); it != disp.end(); ++it) {
+                    keyT d;
+                    Key<NDIM-opdim> nullkey(key.level());
+                    if (op->particle()==1) d=it->merge_with(nullkey);
+                    if (op->particle()==2) d=nullkey.merge_with(*it);
+
+                    uint64_t dsq = d.distsq();
+                    if (dsq != distsq) { // Moved to next shell of neighbors
+                        if (ndone == 0 && dsq > 1) {
+                            // Have at least done the input box and all first
+                            // nearest neighbors, and for all of the last set
+                            // of neighbors had no contribution.  Thus,
+                            // assuming monotonic decrease, we are done.
+                            break;
+                        }
+                        ndone = 0;
+                        distsq = dsq;
+                    } 
+
+                    keyT dest = neighbor(key, d, is_periodic);
+                    if (dest.is_valid()) {
+                        double opnorm = op->norm(key.level(), *it, source);
+
+                        if (cnorm*opnorm> tol/fac) {
+                            ndone++;
+                            shifts.push_back(*it);
+                            dests.push_back(dest);
                         }
                     }
                 }
             }
+            op->add_screening_stats(shifts.size(), disp.size()-shifts.size());
+
+            // Apply all surviving displacements at once and send the
+            // results for each remote owner in a single message
+            const std::vector<tensorT> results = op->apply_batch(source, shifts, c, tol/fac/cnorm);
+            std::map< ProcessID, std::pair< std::vector<keyT>, std::vector<tensorT> > > remote;
+            for (std::size_t i=0; i<results.size(); ++i) {
+                if (results[i].normf() > 0.3*tol/fac) {
+                    const keyT& dest = dests[i];
+                    if (coeffs.is_local(dest)) {
+                        coeffs.send(dest, &nodeT::accumulate2, results[i], coeffs, dest);
+                    }
+                    else {
+                        std::pair< std::vector<keyT>, std::vector<tensorT> >& batch = remote[coeffs.owner(dest)];
+                        batch.first.push_back(dest);
+                        batch.second.push_back(results[i]);
+                    }
+                }
+            }
+            for (typename std::map< ProcessID, std::pair< std::vector<keyT>, std::vector<tensorT> > >::const_iterator
+                     it=remote.begin(); it!=remote.end(); ++it) {
+                woT::task(it->first, &implT::accumulate2_batch, it->second.first, it->second.second);
+            }
+        }
+
+        /// accumulate the results of do_apply for several local boxes (see FunctionNode::accumulate2)
+        void accumulate2_batch(const std::vector<keyT>& keys, const std::vector<tensorT>& results) {
+            for (std::size_t i=0; i<keys.size(); ++i) {
+                coeffs.send(keys[i], &nodeT::accumulate2, results[i], coeffs, keys[i]);
+            }
         }
 
 
@@ -5206,7 +5528,7 @@ namespace madness {
             double operator()(typename dcT::const_iterator& it) const {
                 const nodeT& node = it->second;
                 if (node.has_coeff()) {
-                    double norm = node.coeff().normf();
+                    double norm = node.normf();
                     return norm*norm;
                 }
                 else {
@@ -5362,48 +5684,93 @@ namespace madness {
             mutex->unlock();
         }
 #else
-       template <typename R>
-       static void do_inner_localX(const typename mapT::iterator lstart,
-                                   const typename mapT::iterator lend,
-                                   typename FunctionImpl<R,NDIM>::mapT* rmap_ptr,
-                                   const bool sym,
-                                   Tensor< TENSOR_RESULT_TYPE(T,R) >* result_ptr,
-                                   Mutex* mutex) {
-           Tensor< TENSOR_RESULT_TYPE(T,R) >& result = *result_ptr;
-           //Tensor< TENSOR_RESULT_TYPE(T,R) > r(result.dim(0),result.dim(1));
-           for (typename mapT::iterator lit=lstart; lit!=lend; ++lit) {
-               const keyT& key = lit->first;
-               typename FunctionImpl<R,NDIM>::mapT::iterator rit=rmap_ptr->find(key);
-               if (rit != rmap_ptr->end()) {
-                   const mapvecT& leftv = lit->second;
-                   const typename FunctionImpl<R,NDIM>::mapvecT& rightv =rit->second;
-                   const size_t nleft = leftv.size();
-                   const size_t nright= rightv.size();
-
-                   unsigned int size = leftv[0].second->size();
-                   Tensor<T> Left(nleft, size);
-                   Tensor<R> Right(nright, size);
-                   Tensor< TENSOR_RESULT_TYPE(T,R)> r(nleft, nright);
-                   for(unsigned int iv = 0; iv < nleft; ++iv) Left(iv,_) = *(leftv[iv].second);
-                   for(unsigned int jv = 0; jv < nright; ++jv) Right(jv,_) = *(rightv[jv].second);
-                   // call mxmT from mxm.h in tensor
-                   if(TensorTypeData<T>::iscomplex) Left = Left.conj();  //Should handle complex case and leave real case alone
-                   mxmT(nleft, nright, size, r.ptr(), Left.ptr(), Right.ptr());
-                   mutex->lock();
-                   for(unsigned int iv = 0; iv < nleft; ++iv) {
-                       const int i = leftv[iv].first;
-                       for(unsigned int jv = 0; jv < nright; ++jv) {
-                         const int j = rightv[jv].first;
-                         if (!sym || (sym && i<=j)) result(i,j) += r(iv,jv);
-                       }
-                   }
-                   mutex->unlock();
-               }
-           }
-       }
+        /// Returns the no. of rows of a coefficient panel that is a cache block in \c matrix_inner
+        static long inner_block_rows(long size) {
+            const long nbyte = 128*1024; // So that a left and a right block stay in L2
+            return std::max(1l, long(nbyte/(sizeof(T)*size)));
+        }
+
+        /// Packs the coefficients of the functions at a key into the rows of a panel
+        template <typename Q>
+        static Tensor<Q> pack_inner_panel(const std::vector< std::pair<int,const GenTensor<Q>*> >& v) {
+            const long size = v[0].second->size();
+            const long dims[2] = {long(v.size()), size};
+            Tensor<Q> panel(2, dims, false);
+            for (std::size_t iv = 0; iv < v.size(); ++iv) {
+                MADNESS_ASSERT(v[iv].second->size() == size && v[iv].second->iscontiguous());
+                memcpy(panel.ptr() + iv*size, v[iv].second->ptr(), size*sizeof(Q));
+            }
+            return panel;
+        }
+
+        /// Computes the local contribution of a range of keys to \c matrix_inner
+
+        /// Per key the coefficients of all left and right functions are
+        /// packed into contiguous panels and multiplied in cache blocks of
+        /// rows with \c mxmT (a GEMM with fast BLAS).  If the left and right
+        /// functions are the same (\c lmap is \c rmap) and \c sym is set only
+        /// the upper block triangle is computed, as in SYRK.  Results are
+        /// accumulated in a task-local matrix that is added to \c result once.
+        template <typename R>
+        static void do_inner_localX(const typename mapT::iterator lstart,
+                                    const typename mapT::iterator lend,
+                                    typename FunctionImpl<R,NDIM>::mapT* rmap_ptr,
+                                    const bool sym,
+                                    Tensor< TENSOR_RESULT_TYPE(T,R) >* result_ptr,
+                                    Mutex* mutex) {
+            typedef TENSOR_RESULT_TYPE(T,R) resultT;
+            Tensor<resultT>& result = *result_ptr;
+            Tensor<resultT> r(result.dim(0), result.dim(1));
+
+            std::vector<resultT> tile;
+            for (typename mapT::iterator lit=lstart; lit!=lend; ++lit) {
+                const keyT& key = lit->first;
+                typename FunctionImpl<R,NDIM>::mapT::iterator rit=rmap_ptr->find(key);
+                if (rit == rmap_ptr->end()) continue;
+
+                // Sorting by function index makes the upper block triangle
+                // of the panels the upper triangle of the result
+                mapvecT& leftv = lit->second;
+                typename FunctionImpl<R,NDIM>::mapvecT& rightv = rit->second;
+                const bool syrk = sym && ((void*) &leftv == (void*) &rightv);
+                std::sort(leftv.begin(), leftv.end());
+                if (!syrk) std::sort(rightv.begin(), rightv.end());
+
+                const long nleft = leftv.size();
+                const long nright = rightv.size();
+                const long size = leftv[0].second->size();
+                MADNESS_ASSERT(rightv[0].second->size() == size);
+
+                const Tensor<T> Left = pack_inner_panel(leftv);
+                const Tensor<R> Right = syrk ? Tensor<R>() : pack_inner_panel(rightv);
+                const R* rptr = syrk ? reinterpret_cast<const R*>(Left.ptr()) : Right.ptr();
+                const Tensor<T> Leftc = TensorTypeData<T>::iscomplex ? madness::conj(Left) : Left;
+
+                const long nb = inner_block_rows(size);
+                tile.resize(nb*nb);
+                for (long ilo=0; ilo<nleft; ilo+=nb) {
+                    const long ni = std::min(nb, nleft-ilo);
+                    for (long jlo=(syrk ? ilo : 0); jlo<nright; jlo+=nb) {
+                        const long nj = std::min(nb, nright-jlo);
+                        std::fill(tile.begin(), tile.begin()+ni*nj, resultT(0));
+                        mxmT(ni, nj, size, tile.data(), Leftc.ptr()+ilo*size, rptr+jlo*size);
+                        for (long iv=0; iv<ni; ++iv) {
+                            const int i = leftv[ilo+iv].first;
+                            for (long jv=0; jv<nj; ++jv) {
+                                const int j = rightv[jlo+jv].first;
+                                if (!sym || i<=j) r(i,j) += tile[iv*nj+jv];
+                            }
+                        }
+                    }
+                }
+            }
+            mutex->lock();
+            result += r;
+            mutex->unlock();
+        }
 #endif
 
-        static double conj(float x) {
+        static double conj(double x) {
             return x;
         }
 
@@ -5420,7 +5787,7 @@ namespace madness {
             // This is basically a sparse matrix^T * matrix product
             // Rij = sum(k) Aki * Bkj
             // where i and j index functions and k index the wavelet coeffs
-            // eventually the goal is this structure (don't have jtile yet)
+            // with this structure (see do_inner_localX)
             //
             // do in parallel tiles of k (tensors of coeffs)
             //    do tiles of j
@@ -5429,10 +5796,15 @@ namespace madness {
             //             do k in ktile
             //                Rij += Aki*Bkj
 
+            // The map is shared if the left and right functions are the same
+            bool same = (left.size() == right.size());
+            for (std::size_t i=0; same && i<left.size(); ++i)
+                same = ((const void*) left[i] == (const void*) right[i]);
+
             mapT lmap = make_key_vec_map(left);
             typename FunctionImpl<R,NDIM>::mapT rmap;
             typename FunctionImpl<R,NDIM>::mapT* rmap_ptr = (typename FunctionImpl<R,NDIM>::mapT*)(&lmap);
-            if ((std::vector<const FunctionImpl<R,NDIM>*>*)(&left) != &right) {
+            if (!same) {
                 rmap = FunctionImpl<R,NDIM>::make_key_vec_map(right);
                 rmap_ptr = &rmap;
             }
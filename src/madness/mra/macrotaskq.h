@@ -30,6 +30,8 @@
 #define SRC_MADNESS_MRA_MACROTASKQ_H_
 
 #include <madness/world/cloud.h>
+#include <deque>
+#include <set>
 #include <madness/world/world.h>
 #include <madness/mra/macrotaskpartitioner.h>
 
@@ -102,13 +104,24 @@ public:
 
 
 class MacroTaskQ : public WorldObject< MacroTaskQ> {
+public:
+
+    /// how tasks are handed out to the subworlds
+    enum Scheduler {
+        Central,        ///< universe rank 0 hands out one task at a time (default)
+        Distributed     ///< tasks are pre-assigned by cost to the subworlds, idle subworlds steal remote tasks
+    };
 
+private:
     World& universe;
     std::shared_ptr<World> subworld_ptr;
 	MacroTaskBase::taskqT taskq;
 	std::mutex taskq_mutex;
 	long printlevel=0;
 	long nsubworld=1;
+	Scheduler scheduler=Central;
+	std::deque<long> assigned;      ///< Distributed: tasks assigned to this subworld (on its rank 0 only)
+	long nstolen=0;                 ///< Distributed: number of tasks this subworld stole
     std::shared_ptr< WorldDCPmapInterface< Key<1> > > pmap1;
     std::shared_ptr< WorldDCPmapInterface< Key<2> > > pmap2;
     std::shared_ptr< WorldDCPmapInterface< Key<3> > > pmap3;
@@ -125,6 +138,8 @@ public:
 	World& get_subworld() {return *subworld_ptr;}
 	long get_nsubworld() const {return nsubworld;}
 	void set_printlevel(const long p) {printlevel=p;}
+	void set_scheduler(const Scheduler s) {scheduler=s;}
+	Scheduler get_scheduler() const {return scheduler;}
 
     /// create an empty taskq and initialize the subworlds
 	MacroTaskQ(World& universe, int nworld, const long printlevel=0)
@@ -154,9 +169,10 @@ public:
 	/// run all tasks, tasks may store the results in the cloud
 	void run_all(MacroTaskBase::taskqT vtask=MacroTaskBase::taskqT()) {
 
-		for (const auto& t : vtask) if (universe.rank()==0) t->set_waiting();
+		for (const auto& t : vtask) if (universe.rank()==0 or scheduler==Distributed) t->set_waiting();
 		for (int i=0; i<vtask.size(); ++i) add_replicated_task(vtask[i]);
 		if (printdebug()) print_taskq();
+		if (scheduler==Distributed) assign_tasks();
 
         universe.gop.fence();
         universe.gop.set_forbid_fence(true); // make sure there are no hidden universe fences
@@ -173,9 +189,12 @@ public:
 		World& subworld=get_subworld();
 //		if (printdebug()) print("I am subworld",subworld.id());
 		double tasktime=0.0;
+		double wall00=wall_time(), busytime=0.0;
+		long ntask=0;
 		while (true){
 			long element=get_scheduled_task_number(subworld);
             double cpu0=cpu_time();
+            double wall0=wall_time();
 			if (element<0) break;
 			std::shared_ptr<MacroTaskBase> task=taskq[element];
             if (printdebug()) print("starting task no",element, "in subworld",subworld.id(),"at time",wall_time());
@@ -185,9 +204,12 @@ public:
 			double cpu1=cpu_time();
             set_complete(element);
 			tasktime+=(cpu1-cpu0);
+			busytime+=(wall_time()-wall0);
+			ntask++;
 			if (subworld.rank()==0 and printlevel>=3) printf("completed task %3ld after %6.1fs at time %6.1fs\n",element,cpu1-cpu0,wall_time());
 
 		}
+		double elapsed=wall_time()-wall00;
         universe.gop.set_forbid_fence(false);
 		universe.gop.fence();
 		universe.gop.sum(tasktime);
@@ -197,6 +219,7 @@ public:
             printf("completed taskqueue after    %4.1fs at time %4.1fs\n", cpu11 - cpu00, wall_time());
             printf(" total cpu time / per world  %4.1fs %4.1fs\n", tasktime, tasktime / universe.size());
         }
+        print_utilization(subworld, ntask, busytime, elapsed);
 
 		// cleanup task-persistent input data
 		for (auto& task : taskq) task->cleanup();
@@ -215,7 +238,7 @@ public:
 
 	void add_tasks(MacroTaskBase::taskqT& vtask) {
         for (const auto& t : vtask) {
-            if (universe.rank()==0) t->set_waiting();
+            if (universe.rank()==0 or scheduler==Distributed) t->set_waiting();
             add_replicated_task(t);
         }
 	}
@@ -235,16 +258,116 @@ private:
 		taskq.push_back(task);
 	}
 
-	/// scheduler is located on universe.rank==0
+	/// scheduler is located on universe.rank==0, or distributed over the subworlds' rank 0
 	long get_scheduled_task_number(World& subworld) {
 		long number=0;
-		if (subworld.rank()==0) number=this->send(ProcessID(0), &MacroTaskQ::get_scheduled_task_number_local);
+		if (subworld.rank()==0) {
+			if (scheduler==Distributed) number=get_distributed_task_number();
+			else number=this->send(ProcessID(0), &MacroTaskQ::get_scheduled_task_number_local);
+		}
 		subworld.gop.broadcast_serializable(number, 0);
 		subworld.gop.fence();
 		return number;
 
 	}
 
+	/// the number of subworlds that actually have processes
+	long nactive_subworld() const {
+		return std::min(nsubworld, long(universe.size()));
+	}
+
+	/// the subworld of this process; its rank 0 is the universe process with this rank
+	long subworld_index() const {
+		return universe.rank() % nsubworld;
+	}
+
+	/// pre-assign the waiting tasks to the subworlds (longest processing time first)
+
+	/// The priority of a task is taken as its cost.  Every process computes the same
+	/// assignment from the replicated taskq; only rank 0 of each subworld keeps its share.
+	void assign_tasks() {
+		// a task may have been added more than once (see MacroTask::operator())
+		std::vector<long> waiting;
+		std::set<const MacroTaskBase*> seen;
+		for (std::size_t i=0; i<taskq.size(); ++i) {
+			if (taskq[i]->is_waiting() and seen.insert(taskq[i].get()).second) waiting.push_back(i);
+		}
+		std::stable_sort(waiting.begin(),waiting.end(),[this](const long a, const long b) {
+			return taskq[a]->get_priority() > taskq[b]->get_priority();
+		});
+
+		std::vector<double> cost(nactive_subworld(),0.0);
+		std::lock_guard<std::mutex> lock(taskq_mutex);
+		assigned.clear();
+		nstolen=0;
+		for (long element : waiting) {
+			long iworld=std::min_element(cost.begin(),cost.end())-cost.begin();
+			cost[iworld]+=taskq[element]->get_priority();
+			if (iworld==subworld_index() and get_subworld().rank()==0) assigned.push_back(element);
+		}
+	}
+
+	/// take the most expensive own task, or steal one from another subworld
+	long get_distributed_task_number() {
+		{
+			std::lock_guard<std::mutex> lock(taskq_mutex);
+			if (not assigned.empty()) {
+				long element=assigned.front();
+				assigned.pop_front();
+				taskq[element]->set_running();
+				return element;
+			}
+		}
+
+		// Tasks are never added while running, so if no other subworld has a
+		// task left at the time it is asked we are done
+		const long n=nactive_subworld();
+		for (long i=1; i<n; ++i) {
+			ProcessID victim=(subworld_index()+i)%n;
+			long element=this->send(victim, &MacroTaskQ::steal_task_number_local);
+			if (element>=0) {
+				taskq[element]->set_running();
+				nstolen++;
+				if (printdebug()) print("subworld",subworld_index(),"stole task",element,"from subworld",victim);
+				return element;
+			}
+		}
+		return -1;
+	}
+
+	/// give away the cheapest task assigned to this subworld
+	long steal_task_number_local() {
+		std::lock_guard<std::mutex> lock(taskq_mutex);
+		if (assigned.empty()) return -1;
+		long element=assigned.back();
+		assigned.pop_back();
+		return element;
+	}
+
+	/// report the busy time and the number of executed and stolen tasks of each subworld
+	void print_utilization(World& subworld, const long ntask, const double busytime,
+			const double elapsed) {
+		const long n=nactive_subworld();
+		std::vector<double> stats(4*n,0.0);
+		if (subworld.rank()==0) {
+			const long i=subworld_index();
+			stats[4*i]=ntask;
+			stats[4*i+1]=nstolen;
+			stats[4*i+2]=busytime;
+			stats[4*i+3]=elapsed;
+		}
+		universe.gop.sum(stats.data(),stats.size());
+		if (printtimings()) {
+			printf("\n subworld utilization (%s scheduler)\n", scheduler==Distributed ? "distributed" : "central");
+			printf(" subworld   #tasks  #stolen     busy  elapsed  utilization\n");
+			for (long i=0; i<n; ++i) {
+				const double util=(stats[4*i+3]>0.0) ? stats[4*i+2]/stats[4*i+3] : 0.0;
+				printf(" %8ld %8ld %8ld %7.2fs %7.2fs %11.1f%%\n", i, long(stats[4*i]), long(stats[4*i+1]),
+						stats[4*i+2], stats[4*i+3], 100.0*util);
+			}
+		}
+	}
+
 	long get_scheduled_task_number_local() {
 		MADNESS_ASSERT(universe.rank()==0);
 		std::lock_guard<std::mutex> lock(taskq_mutex);
@@ -262,7 +385,8 @@ private:
 
 	/// scheduler is located on rank==0
 	void set_complete(const long task_number) const {
-		this->task(ProcessID(0), &MacroTaskQ::set_complete_local, task_number);
+		if (scheduler==Distributed) taskq[task_number]->set_complete();
+		else this->task(ProcessID(0), &MacroTaskQ::set_complete_local, task_number);
 	}
 
 	/// scheduler is located on rank==0
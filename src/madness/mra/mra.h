@@ -601,11 +601,27 @@ namespace madness {
             verify();
 //            if (!is_compressed()) compress();
             impl->truncate(tol,fence);
+            if (fence) impl->demote(FunctionDefaults<NDIM>::get_low_precision_tol(),true);
             if (VERIFY_TREE) verify_tree();
             return *this;
         }
 
 
+        /// Keeps the coefficients of nodes with norm below \c tol in single precision
+
+        /// If \c tol is zero the default from FunctionDefaults is used.
+        /// Coefficients are promoted back to double precision when accessed.
+        /// No other operation may be in progress on this function.
+        const Function<T,NDIM>& demote(double tol = 0.0, bool fence = true) const {
+            PROFILE_MEMBER_FUNC(Function);
+            if (!impl) return *this;
+            verify();
+            if (tol == 0.0) tol = FunctionDefaults<NDIM>::get_low_precision_tol();
+            impl->demote(tol,fence);
+            return *this;
+        }
+
+
         /// Returns a shared-pointer to the implementation
         const std::shared_ptr< FunctionImpl<T,NDIM> >& get_impl() const {
             PROFILE_MEMBER_FUNC(Function);
@@ -1484,12 +1500,13 @@ namespace madness {
 
         /// This is replaced with op(vector of functions) ... private
         template <typename opT>
-        Function<T,NDIM>& multiop_values(const opT& op, const std::vector< Function<T,NDIM> >& vf) {
+        Function<T,NDIM>& multiop_values(const opT& op, const std::vector< Function<T,NDIM> >& vf,
+                const std::size_t batchsize=1) {
             std::vector<implT*> v(vf.size(),NULL);
             for (unsigned int i=0; i<v.size(); ++i) {
                 if (vf[i].is_initialized()) v[i] = vf[i].get_impl().get();
             }
-            impl->multiop_values(op, v);
+            impl->multiop_values(op, v, batchsize);
             world().gop.fence();
             if (VERIFY_TREE) verify_tree();
 
@@ -1502,11 +1519,12 @@ namespace madness {
         /// @param[in]  op   the operator working on vin
         /// @param[in]  vin  vector of input Functions
         /// @param[out] vout vector of output Functions vout = op(vin)
+        /// @param[in]  batchsize number of boxes passed to a pointwise op at once
         template <typename opT>
         void multi_to_multi_op_values(const opT& op,
                 const std::vector< Function<T,NDIM> >& vin,
                 std::vector< Function<T,NDIM> >& vout,
-                const bool fence=true) {
+                const bool fence=true, const std::size_t batchsize=1) {
             std::vector<implT*> vimplin(vin.size(),NULL);
             for (unsigned int i=0; i<vin.size(); ++i) {
                 if (vin[i].is_initialized()) vimplin[i] = vin[i].get_impl().get();
@@ -1516,7 +1534,7 @@ namespace madness {
                 if (vout[i].is_initialized()) vimplout[i] = vout[i].get_impl().get();
             }
 
-            impl->multi_to_multi_op_values(op, vimplin, vimplout, fence);
+            impl->multi_to_multi_op_values(op, vimplin, vimplout, fence, batchsize);
             if (VERIFY_TREE) verify_tree();
 
         }
@@ -1664,10 +1682,11 @@ namespace madness {
 
 //    template <typename T, typename opT, std::size_t NDIM>
     template <typename T, typename opT, std::size_t NDIM>
-    Function<T,NDIM> multiop_values(const opT& op, const std::vector< Function<T,NDIM> >& vf) {
+    Function<T,NDIM> multiop_values(const opT& op, const std::vector< Function<T,NDIM> >& vf,
+            const std::size_t batchsize=1) {
         Function<T,NDIM> r;
         r.set_impl(vf[0], false);
-        r.multiop_values(op, vf);
+        r.multiop_values(op, vf, batchsize);
         return r;
     }
 
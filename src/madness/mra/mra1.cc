@@ -32,6 +32,7 @@
 #include <madness/mra/mra.h>
 #define MPRAIMPLX
 #include <madness/mra/mraimpl.h>
+#include <madness/mra/sharedtree.h>
 #include <madness/world/world_object.h>
 #include <madness/world/worldmutex.h>
 #include <madness/world/worlddc.h>
@@ -77,6 +78,11 @@ namespace madness {
     template <> volatile std::list<detail::PendingMsg> WorldObject<WorldContainerImpl<Key<1>, LBNodeDeux<1>, Hash<Key<1> > > >::pending = std::list<detail::PendingMsg>();
     template <>  Spinlock WorldObject<WorldContainerImpl<Key<1>, LBNodeDeux<1>, Hash<Key<1> > > >::pending_mutex(0);
 
+    template <> volatile std::list<detail::PendingMsg> WorldObject<WorldContainerImpl<Key<1>, SharedTreeNode<double, 1>, Hash<Key<1> > > >::pending = std::list<detail::PendingMsg>();
+    template <> Spinlock WorldObject<WorldContainerImpl<Key<1>, SharedTreeNode<double, 1>, Hash<Key<1> > > >::pending_mutex(0);
+    template <> volatile std::list<detail::PendingMsg> WorldObject<WorldContainerImpl<Key<1>, SharedTreeNode<std::complex<double>, 1>, Hash<Key<1> > > >::pending = std::list<detail::PendingMsg>();
+    template <> Spinlock WorldObject<WorldContainerImpl<Key<1>, SharedTreeNode<std::complex<double>, 1>, Hash<Key<1> > > >::pending_mutex(0);
+
     template void plotdx<double,1>(const Function<double,1>&, const char*, const Tensor<double>&,
                                    const std::vector<long>&, bool binary);
     template void plotdx<double_complex,1>(const Function<double_complex,1>&, const char*, const Tensor<double>&,
@@ -32,6 +32,7 @@
 #include <madness/mra/mra.h>
 #define MPRAIMPLX
 #include <madness/mra/mraimpl.h>
+#include <madness/mra/sharedtree.h>
 #include <madness/world/world_object.h>
 #include <madness/world/worldmutex.h>
 #include <list>
@@ -72,6 +73,11 @@ namespace madness {
     template <> volatile std::list<detail::PendingMsg> WorldObject<WorldContainerImpl<Key<2>, LBNodeDeux<2>, Hash<Key<2> > > >::pending = std::list<detail::PendingMsg>();
     template <>  Spinlock WorldObject<WorldContainerImpl<Key<2>, LBNodeDeux<2>, Hash<Key<2> > > >::pending_mutex(0);
 
+    template <> volatile std::list<detail::PendingMsg> WorldObject<WorldContainerImpl<Key<2>, SharedTreeNode<double, 2>, Hash<Key<2> > > >::pending = std::list<detail::PendingMsg>();
+    template <> Spinlock WorldObject<WorldContainerImpl<Key<2>, SharedTreeNode<double, 2>, Hash<Key<2> > > >::pending_mutex(0);
+    template <> volatile std::list<detail::PendingMsg> WorldObject<WorldContainerImpl<Key<2>, SharedTreeNode<std::complex<double>, 2>, Hash<Key<2> > > >::pending = std::list<detail::PendingMsg>();
+    template <> Spinlock WorldObject<WorldContainerImpl<Key<2>, SharedTreeNode<std::complex<double>, 2>, Hash<Key<2> > > >::pending_mutex(0);
+
     // These implicit instantiations must be below the explicit ones above in order not to offend LLVM
     template class FunctionDefaults<2>;
     template class Function<double, 2>;
@@ -32,6 +32,7 @@
 #include <madness/mra/mra.h>
 #define MPRAIMPLX
 #include <madness/mra/mraimpl.h>
+#include <madness/mra/sharedtree.h>
 #include <madness/world/world_object.h>
 #include <madness/world/worldmutex.h>
 #include <list>
@@ -74,6 +75,11 @@ namespace madness {
     template <> volatile std::list<detail::PendingMsg> WorldObject<WorldContainerImpl<Key<4>, LBNodeDeux<4>, Hash<Key<4> > > >::pending = std::list<detail::PendingMsg>();
     template <>  Spinlock WorldObject<WorldContainerImpl<Key<4>, LBNodeDeux<4>, Hash<Key<4> > > >::pending_mutex(0);
 
+    template <> volatile std::list<detail::PendingMsg> WorldObject<WorldContainerImpl<Key<4>, SharedTreeNode<double, 4>, Hash<Key<4> > > >::pending = std::list<detail::PendingMsg>();
+    template <> Spinlock WorldObject<WorldContainerImpl<Key<4>, SharedTreeNode<double, 4>, Hash<Key<4> > > >::pending_mutex(0);
+    template <> volatile std::list<detail::PendingMsg> WorldObject<WorldContainerImpl<Key<4>, SharedTreeNode<std::complex<double>, 4>, Hash<Key<4> > > >::pending = std::list<detail::PendingMsg>();
+    template <> Spinlock WorldObject<WorldContainerImpl<Key<4>, SharedTreeNode<std::complex<double>, 4>, Hash<Key<4> > > >::pending_mutex(0);
+
     // These implicit instantiations must be below the explicit ones above in order not to offend LLVM
     template class FunctionDefaults<4>;
     template class Function<double, 4>;
@@ -1206,7 +1206,50 @@ namespace madness {
     /// @param[in]  targs   target tensor arguments (threshold and full/low rank)
     template <typename T, std::size_t NDIM>
     void FunctionImpl<T,NDIM>::reduce_rank(const double thresh, bool fence) {
-        flo_unary_op_node_inplace(do_reduce_rank(thresh),fence);
+        reduce_rank(std::vector<std::pair<implT*,double> >(1,std::make_pair(this,thresh)),fence);
+    }
+
+    template <typename T, std::size_t NDIM>
+    void FunctionImpl<T,NDIM>::reduce_rank(const std::vector<std::pair<implT*,double> >& impls,
+            bool fence) {
+        if (impls.empty()) return;
+        World& world=impls.front().first->world;
+
+        // collect the low-rank coefficients; demoted nodes hold full tensors
+        typedef std::tuple<double,long,coeffT*> itemT;
+        std::vector<itemT> items;
+        for (const auto& f : impls) {
+            for (auto it=f.first->coeffs.begin(); it!=f.first->coeffs.end(); ++it) {
+                nodeT& node=it->second;
+                if (not node.has_coeff() or node.is_demoted()) continue;
+                coeffT& c=node.coeff();
+                if (not c.is_full_tensor()) items.push_back(itemT(f.second,c.rank(),&c));
+            }
+        }
+
+        // equal thresholds and ranks are neighbors
+        std::sort(items.begin(),items.end());
+
+        const std::size_t batchsize=32;
+        for (std::size_t i=0; i<items.size(); ) {
+            const double thresh=std::get<0>(items[i]);
+            std::vector<coeffT*> batch;
+            for (; i<items.size() and batch.size()<batchsize and std::get<0>(items[i])==thresh; ++i)
+                batch.push_back(std::get<2>(items[i]));
+            world.taskq.add(&implT::reduce_rank_batch, batch, thresh);
+        }
+        if (fence) world.gop.fence();
+    }
+
+    template <typename T, std::size_t NDIM>
+    void FunctionImpl<T,NDIM>::reduce_rank_batch(const std::vector<coeffT*>& batch,
+            const double thresh) {
+        std::vector<SVDTensor<T>*> svd;
+        for (coeffT* c : batch) {
+            if (c->is_svd_tensor()) svd.push_back(&c->get_svdtensor());
+            else c->reduce_rank(thresh);
+        }
+        SVDTensor<T>::reduce_rank_batched(svd,thresh*coeffT::fac_reduce());
     }
 
 
@@ -1265,6 +1308,27 @@ namespace madness {
         return transform(s,cdata.hg);
     }
 
+    template <typename T, std::size_t NDIM>
+    typename FunctionImpl<T,NDIM>::tensorT FunctionImpl<T,NDIM>::transform_columns(const tensorT& s,
+            const Tensor<double>& c) const {
+        MADNESS_ASSERT(s.ndim() == 2 && s.iscontiguous());
+        const long size = s.dim(0), n = s.dim(1);
+        const long dimj = c.dim(1), dimi = size*n/dimj;
+        const long dims[2] = {n, size};
+        tensorT r(2,dims,false), w(2,dims,false);
+
+        // Each pass contracts the leading index and cycles it to the end,
+        // so after NDIM passes the function index leads
+        const T* in = s.ptr();
+        T* out = (NDIM%2) ? r.ptr() : w.ptr();
+        for (std::size_t d=0; d<NDIM; ++d) {
+            mTxmq(dimi, dimj, dimj, out, in, c.ptr());
+            in = out;
+            out = (out == r.ptr()) ? w.ptr() : r.ptr();
+        }
+        return r;
+    }
+
     /// downsample the sum coefficients of level n+1 to sum coeffs on level n
 
     /// specialization of the filter method, will yield only the sum coefficients
@@ -1524,6 +1588,37 @@ namespace madness {
             world.gop.fence();
     }
 
+    template <typename T, std::size_t NDIM>
+    void FunctionImpl<T,NDIM>::compress_vector(const std::vector<implT*>& v, bool fence) {
+        if (v.empty()) return;
+        implT* host = v[0];
+        for (implT* f : v) {
+            MADNESS_CHECK(f->is_reconstructed());
+            MADNESS_ASSERT(f->get_k() == host->get_k() && f->get_pmap() == host->get_pmap());
+            f->set_tree_state(compressed);
+        }
+        if (host->world.rank() == host->coeffs.owner(host->cdata.key0))
+            host->compress_spawn_vector(v, host->cdata.key0);
+        if (fence)
+            host->world.gop.fence();
+    }
+
+    template <typename T, std::size_t NDIM>
+    void FunctionImpl<T,NDIM>::reconstruct_vector(const std::vector<implT*>& v, bool fence) {
+        if (v.empty()) return;
+        implT* host = v[0];
+        for (implT* f : v) {
+            MADNESS_CHECK(f->is_compressed());
+            MADNESS_ASSERT(f->get_k() == host->get_k() && f->get_pmap() == host->get_pmap());
+            f->set_tree_state(reconstructed);
+        }
+        if (host->world.rank() == host->coeffs.owner(host->cdata.key0))
+            host->woT::task(host->world.rank(), &implT::reconstruct_op_vector, v, host->cdata.key0,
+                            std::vector<coeffT>(v.size()));
+        if (fence)
+            host->world.gop.fence();
+    }
+
     /// convert this to redundant, i.e. have sum coefficients on all levels
     template <typename T, std::size_t NDIM>
     void FunctionImpl<T,NDIM>::make_redundant(const bool fence) {
@@ -1911,7 +2006,8 @@ namespace madness {
         typename dcT::const_iterator end = coeffs.end();
         for (typename dcT::const_iterator it=coeffs.begin(); it!=end; ++it) {
             const nodeT& node = it->second;
-            if (node.has_coeff()) sum+=node.coeff().real_size();
+            if (node.is_demoted()) sum+=node.size() - node.low_precision_savings()/sizeof(T);
+            else if (node.has_coeff()) sum+=node.coeff().real_size();
         }
         world.gop.sum(sum);
         return sum;
@@ -1924,7 +2020,8 @@ namespace madness {
         typename dcT::const_iterator end = coeffs.end();
         for (typename dcT::const_iterator it=coeffs.begin(); it!=end; ++it) {
             const nodeT& node = it->second;
-            if (node.has_coeff()) sum+=node.coeff().nCoeff();
+            if (node.is_demoted()) sum+=node.size();
+            else if (node.has_coeff()) sum+=node.coeff().nCoeff();
         }
         world.gop.sum(sum);
         return sum;
@@ -1949,9 +2046,24 @@ namespace madness {
             norm=sqrt(local);
         }
 
+        // nodes kept in single precision and the memory saved by them
+        std::size_t ndemoted=0, saved=0;
+        typename dcT::const_iterator end = coeffs.end();
+        for (typename dcT::const_iterator it=coeffs.begin(); it!=end; ++it) {
+            const nodeT& node = it->second;
+            if (node.is_demoted()) {
+                ++ndemoted;
+                saved+=node.low_precision_savings();
+            }
+        }
+        this->world.gop.sum(ndemoted);
+        this->world.gop.sum(saved);
+
         if (this->world.rank()==0) {
             printf("%40s at time %.1fs: norm/tree/#coeff/size: %7.5f %zu, %6.3f m, %6.3f GByte\n",
                    (name.c_str()), wall, norm, tsize,double(ncoeff)*1.e-6,double(ncoeff)/fac*d);
+            if (ndemoted>0) printf("%40s single precision nodes/saved: %zu, %6.3f GByte\n",
+                   "", ndemoted, double(saved)/fac);
         }
     }
 
@@ -2120,6 +2232,72 @@ namespace madness {
         }
     }
 
+    template <typename T, std::size_t NDIM>
+    void FunctionImpl<T,NDIM>::reconstruct_op_vector(const std::vector<implT*>& v, const keyT& key,
+            const std::vector<coeffT>& s) {
+        // Same as reconstruct_op for each function, except that the
+        // functions refined here are unfiltered together
+        std::vector<implT*> parents;
+        std::vector<tensorT> d;
+        for (std::size_t i=0; i<v.size(); ++i) {
+            implT* f = v[i];
+            typename dcT::iterator it = f->coeffs.find(key).get();
+            if (it == f->coeffs.end()) {
+                f->coeffs.replace(key,nodeT(coeffT(),false));
+                it = f->coeffs.find(key).get();
+            }
+            nodeT& node = it->second;
+
+            if (node.has_children() && !node.has_coeff()) {
+                node.set_coeff(coeffT(cdata.v2k,f->targs));
+            }
+
+            if (node.has_children() || node.has_coeff()) {
+                coeffT dd = node.coeff();
+                if (!dd.has_data()) dd = coeffT(cdata.v2k,f->targs);
+                if (key.level() > 0) dd(cdata.s0) += s[i];
+                if (dd.dim(0)==2*get_k()) {
+                    parents.push_back(f);
+                    d.push_back(dd.full_tensor());
+                    node.clear_coeff();
+                    node.set_has_children(true);
+                } else {
+                    MADNESS_ASSERT(node.is_leaf());
+                    node.coeff().reduce_rank(f->targs.thresh);
+                }
+            }
+            else {
+                coeffT ss=s[i];
+                if (s[i].has_no_data()) ss=coeffT(cdata.vk,f->targs);
+                if (key.level()) node.set_coeff(copy(ss));
+                else node.set_coeff(ss);
+            }
+        }
+        if (parents.empty()) return;
+
+        const long n = parents.size(), size = d[0].size();
+        const long dims[2] = {size, n};
+        tensorT dd(2,dims,false);
+        for (long j=0; j<n; ++j) {
+            const tensorT dj = d[j].iscontiguous() ? d[j] : copy(d[j]);
+            const T* p = dj.ptr();
+            for (long i=0; i<size; ++i) dd(i,j) = p[i];
+        }
+        const tensorT r = transform_columns(dd,cdata.hg);
+
+        std::vector<tensorT> u(n);
+        for (long j=0; j<n; ++j) u[j] = r(j,_).reshape(cdata.v2k);
+        for (KeyChildIterator<NDIM> kit(key); kit; ++kit) {
+            const keyT& child = kit.key();
+            std::vector<coeffT> ss(n);
+            for (long j=0; j<n; ++j) {
+                ss[j] = coeffT(copy(u[j](child_patch(child))));
+                ss[j].reduce_rank(parents[j]->thresh);
+            }
+            woT::task(coeffs.owner(child), &implT::reconstruct_op_vector, parents, child, ss);
+        }
+    }
+
     template <typename T, std::size_t NDIM>
     Tensor<T> fcube(const Key<NDIM>& key, T (*f)(const Vector<double,NDIM>&), const Tensor<double>& qx) {
         //      fcube(key,typename FunctionFactory<T,NDIM>::FunctorInterfaceWrapper(f) , qx, fval);
@@ -3197,6 +3375,96 @@ namespace madness {
         }
     }
 
+    template <typename T, std::size_t NDIM>
+    Future< std::vector< GenTensor<T> > > FunctionImpl<T,NDIM>::compress_spawn_vector(
+            const std::vector<implT*>& v, const keyT& key) {
+        std::vector<coeffT> sums(v.size());
+        std::vector<implT*> parents;
+        for (std::size_t i=0; i<v.size(); ++i) {
+            MADNESS_ASSERT(v[i]->coeffs.probe(key));
+            nodeT& node = v[i]->coeffs.find(key).get()->second;
+            if (node.has_children()) {
+                parents.push_back(v[i]);
+            } else {
+                sums[i] = node.coeff();
+                node.clear_coeff();
+                node.set_dnorm(0.0);
+            }
+        }
+        if (parents.empty()) return Future< std::vector<coeffT> >(sums);
+
+        // One message per child for all functions refined here
+        std::vector< Future< std::vector<coeffT> > > c = future_vector_factory< std::vector<coeffT> >(1<<NDIM);
+        int i=0;
+        for (KeyChildIterator<NDIM> kit(key); kit; ++kit,++i) {
+            c[i] = woT::task(coeffs.owner(kit.key()), &implT::compress_spawn_vector, parents, kit.key(),
+                             TaskAttributes::hipri());
+        }
+        return woT::task(world.rank(), &implT::compress_op_vector, v, key, sums, c);
+    }
+
+    template <typename T, std::size_t NDIM>
+    std::vector< GenTensor<T> > FunctionImpl<T,NDIM>::compress_op_vector(const std::vector<implT*>& v,
+            const keyT& key, const std::vector<coeffT>& sums,
+            const std::vector< Future< std::vector<coeffT> > >& c) {
+        double cpu0=cpu_time();
+        // Copy child scaling coeffs of each refined function into a column
+        tensorT dj(cdata.v2k,false);
+        const long n = c[0].get().size(), size = dj.size();
+        const long dims[2] = {size, n};
+        tensorT d(2,dims,false);
+        for (long j=0; j<n; ++j) {
+            int i=0;
+            for (KeyChildIterator<NDIM> kit(key); kit; ++kit,++i) {
+                dj(child_patch(kit.key())) = c[i].get()[j].full_tensor();
+            }
+            const T* p = dj.ptr();
+            for (long i=0; i<size; ++i) d(i,j) = p[i];
+        }
+
+        const tensorT r = transform_columns(d,cdata.hgT);
+        double cpu1=cpu_time();
+        timer_filter.accumulate(cpu1-cpu0);
+        cpu0=cpu1;
+
+        std::vector<coeffT> result(v.size());
+        long j=0;
+        for (std::size_t i=0; i<v.size(); ++i) {
+            implT* f = v[i];
+            typename dcT::accessor acc;
+            const auto found = f->coeffs.find(acc, key);
+            MADNESS_CHECK(found);
+            if (!acc->second.has_children()) {
+                result[i] = sums[i];
+                continue;
+            }
+
+            tensorT dd = copy(r(j++,_)).reshape(cdata.v2k);
+            if (acc->second.has_coeff()) {
+                const tensorT cc = acc->second.coeff().full_tensor_copy();
+                if (cc.dim(0) == get_k()) {
+                    dd(cdata.s0) += cc;
+                }
+                else {
+                    dd += cc;
+                }
+            }
+
+            // tighter thresh for internal nodes
+            TensorArgs targs2=f->targs;
+            targs2.thresh*=0.1;
+
+            // need the deep copy for contiguity
+            result[i]=coeffT(copy(dd(cdata.s0)));
+            if (key.level()> 0) dd(cdata.s0) = 0.0;
+            acc->second.set_coeff(coeffT(dd,targs2));
+        }
+        MADNESS_ASSERT(j == n);
+        cpu1=cpu_time();
+        timer_compress_svd.accumulate(cpu1-cpu0);
+        return result;
+    }
+
     template <typename T, std::size_t NDIM>
     void FunctionImpl<T,NDIM>::plot_cube_kernel(archive::archive_ptr< Tensor<T> > ptr,
                                                 const keyT& key,
@@ -3419,6 +3687,7 @@ namespace madness {
         autorefine = true;
         debug = false;
         truncate_on_project = true;
+        low_precision_tol = 0.0;
         apply_randomize = false;
         project_randomize = false;
         bc = BoundaryConditions<NDIM>(BC_FREE);
@@ -3451,6 +3720,7 @@ namespace madness {
     		std::cout << "                      autorefine" <<  ": " << autorefine << std::endl;
     		std::cout << "                           debug" <<  ": " << debug << std::endl;
     		std::cout << "             truncate_on_project" <<  ": " << truncate_on_project << std::endl;
+    		std::cout << "               low_precision_tol" <<  ": " << low_precision_tol << std::endl;
     		std::cout << "                 apply_randomize" <<  ": " << apply_randomize << std::endl;
     		std::cout << "               project_randomize" <<  ": " << project_randomize << std::endl;
     		std::cout << "                              bc" <<  ": " << bc << std::endl;
@@ -3471,6 +3741,7 @@ namespace madness {
     template <std::size_t NDIM> bool FunctionDefaults<NDIM>::autorefine;
     template <std::size_t NDIM> bool FunctionDefaults<NDIM>::debug;
     template <std::size_t NDIM> bool FunctionDefaults<NDIM>::truncate_on_project;
+    template <std::size_t NDIM> double FunctionDefaults<NDIM>::low_precision_tol;
     template <std::size_t NDIM> bool FunctionDefaults<NDIM>::apply_randomize;
     template <std::size_t NDIM> bool FunctionDefaults<NDIM>::project_randomize;
     template <std::size_t NDIM> BoundaryConditions<NDIM> FunctionDefaults<NDIM>::bc;
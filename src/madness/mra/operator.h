@@ -39,6 +39,9 @@
 
 #include <type_traits>
 #include <limits.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
 #include <madness/mra/adquad.h>
 #include <madness/tensor/aligned.h>
 #include <madness/tensor/tensor_lapack.h>
@@ -133,6 +136,12 @@ namespace madness {
         bool is_slaterf12;
         double mu_;
 
+        /// Displacements of one level with their operator norms, sorted by decreasing norm
+        struct DisplacementNorms {
+            double cutoff;  ///< Displacements with a smaller norm have been pruned
+            std::vector< std::pair<Key<NDIM>,double> > disp;
+        };
+
     private:
 
 
@@ -149,6 +158,15 @@ namespace madness {
         mutable SimpleCache< SeparatedConvolutionData<Q,NDIM>, NDIM > data; ///< cache for all terms, dims and displacements
         mutable SimpleCache< SeparatedConvolutionData<Q,NDIM>, 2*NDIM > mod_data; ///< cache for all terms, dims and displacements
 
+        /// Screening tables and statistics of do_apply ... shared by copies of the operator
+        struct DisplacementScreening {
+            std::shared_ptr<const DisplacementNorms> norms[64]; ///< table for each level (see get_disp_norms)
+            Mutex mutex;                            ///< serializes building the tables
+            std::atomic<unsigned long> ndone{0};    ///< # displacements applied
+            std::atomic<unsigned long> nskipped{0}; ///< # displacements screened out
+        };
+        std::shared_ptr<DisplacementScreening> screening = std::make_shared<DisplacementScreening>();
+
     public:
 
         bool& modified() {return modified_;}
@@ -228,17 +246,35 @@ namespace madness {
             for (std::size_t i=0; i<NDIM; ++i) size *= dimk;
             long dimi = size/dimk;
 
-            R* MADNESS_RESTRICT w1=work1.ptr();
-            R* MADNESS_RESTRICT w2=work2.ptr();
-
 #ifdef HAVE_IBMBGQ
-            mTxmq_padding(dimi, trans[0].r, dimk, dimk, w1, f.ptr(), trans[0].U);
+            mTxmq_padding(dimi, trans[0].r, dimk, dimk, work1.ptr(), f.ptr(), trans[0].U);
 #else
-            mTxmq(dimi, trans[0].r, dimk, w1, f.ptr(), trans[0].U, dimk);
+            mTxmq(dimi, trans[0].r, dimk, work1.ptr(), f.ptr(), trans[0].U, dimk);
 #endif
+            apply_transformation_tail(dimk, trans, work1, work2, mufac, result);
+        }
+
+
+        /// accumulate into result, given the transformation of the first dimension in work1
+
+        /// work1 holds the (dimk^(NDIM-1),trans[0].r) matrix produced by the
+        /// first step of apply_transformation
+        template <typename R>
+        void apply_transformation_tail(long dimk,
+                                       const Transformation trans[NDIM],
+                                       Tensor<R>& work1,
+                                       Tensor<R>& work2,
+                                       const Q mufac,
+                                       Tensor<R>& result) const {
+
+            long size = 1;
+            for (std::size_t i=0; i<NDIM; ++i) size *= dimk;
+
+            R* MADNESS_RESTRICT w1=work1.ptr();
+            R* MADNESS_RESTRICT w2=work2.ptr();
 
             size = trans[0].r * size / dimk;
-            dimi = size/dimk;
+            long dimi = size/dimk;
             for (std::size_t d=1; d<NDIM; ++d) {
 #ifdef HAVE_IBMBGQ
                 mTxmq_padding(dimi, trans[d].r, dimk, dimk, w2, w1, trans[d].U);
@@ -353,6 +389,82 @@ namespace madness {
         }
 
 
+        /// Select the 1D transformations of one block of one separated term
+
+        /// In each dimension the full matrix is used, or its SVD truncated
+        /// at tol if that is cheaper.
+        /// @param[in]  dimk    dimension of the block (2k for R, k for T and for modified NS)
+        /// @param[in]  t_block select the T block instead of the R block
+        /// @param[out] trans   the transformations
+        /// @return     false if the rank in some dimension is zero
+        bool make_transformation(long dimk, bool t_block,
+                                 const ConvolutionData1D<Q>* const ops_1d[NDIM],
+                                 double tol, Transformation trans[NDIM]) const {
+            long break_even;
+            if (NDIM==1) break_even = long(0.5*dimk);
+            else if (NDIM==2) break_even = long(0.6*dimk);
+            else if (NDIM==3) break_even=long(0.65*dimk);
+            else break_even=long(0.7*dimk);
+            for (std::size_t d=0; d<NDIM; ++d) {
+                const ConvolutionData1D<Q>& op = *ops_1d[d];
+                const Tensor<typename Tensor<Q>::scalar_type>& s = t_block ? op.Ts : op.Rs;
+                long r;
+                for (r=0; r<dimk; ++r) {
+                    if (s[r] < tol) break;
+                }
+                if (r >= break_even) {
+                    trans[d].r = dimk;
+                    trans[d].U = t_block ? op.T.ptr() : op.R.ptr();
+                    trans[d].VT = 0;
+                }
+                else {
+
+#ifdef USE_GENTENSOR
+                    r = std::max(2L,r+(r&1L)); // (needed for 6D == when GENTENSOR is on) NOLONGER NEED TO FORCE OPERATOR RANK TO BE EVEN
+#endif
+                    if (r == 0) return false;
+                    trans[d].r = r;
+                    trans[d].U = t_block ? op.TU.ptr() : op.RU.ptr();
+                    trans[d].VT = t_block ? op.TVT.ptr() : op.RVT.ptr();
+                }
+            }
+            return true;
+        }
+
+
+        /// Select the transformations of the R and T blocks of one separated term
+
+        /// @param[out] do_r    true if the R block contributes (transformations in trans_r)
+        /// @param[out] do_t    true if the T block contributes (transformations in trans_t)
+        void make_muop_transformations(ApplyTerms at,
+                                       const ConvolutionData1D<Q>* const ops_1d[NDIM],
+                                       double tol,
+                                       Transformation trans_r[NDIM], bool& do_r,
+                                       Transformation trans_t[NDIM], bool& do_t) const {
+            do_r = do_t = false;
+
+            double Rnorm = 1.0;
+            for (std::size_t d=0; d<NDIM; ++d) Rnorm *= ops_1d[d]->Rnorm;
+
+            if (at.r_term and (Rnorm > 1.e-20)) {
+                tol = tol/(Rnorm*NDIM);  // Errors are relative within here
+
+                // Determine rank of SVD to use or if to use the full matrix
+                long twok = 2*k;
+                if (modified()) twok=k;
+                do_r = make_transformation(twok, false, ops_1d, tol, trans_r);
+            }
+
+            double Tnorm = 1.0;
+            for (std::size_t d=0; d<NDIM; ++d) Tnorm *= ops_1d[d]->Tnorm;
+
+            if (at.t_term and (Tnorm>0.0)) {
+                tol = tol/(Tnorm*NDIM);  // Errors are relative within here
+                do_t = make_transformation(k, true, ops_1d, tol, trans_t);
+            }
+        }
+
+
         /// Apply one of the separated terms, accumulating into the result
         template <typename T>
         void muopxv_fast(ApplyTerms at,
@@ -366,100 +478,79 @@ namespace madness {
                          Tensor<TENSOR_RESULT_TYPE(T,Q)>& work2) const {
 
             //PROFILE_MEMBER_FUNC(SeparatedConvolution); // Too fine grain for routine profiling
-            Transformation trans[NDIM];
-            Tensor<T> trans2[NDIM];
+            Transformation trans_r[NDIM], trans_t[NDIM];
+            bool do_r, do_t;
+            make_muop_transformations(at, ops_1d, tol, trans_r, do_r, trans_t, do_t);
 
-            double Rnorm = 1.0;
-            for (std::size_t d=0; d<NDIM; ++d) Rnorm *= ops_1d[d]->Rnorm;
-
-            if (at.r_term and (Rnorm > 1.e-20)) {
-
-                tol = tol/(Rnorm*NDIM);  // Errors are relative within here
-
-                // Determine rank of SVD to use or if to use the full matrix
+            if (do_r) {
                 long twok = 2*k;
                 if (modified()) twok=k;
+                apply_transformation(twok, trans_r, f, work1, work2, mufac, result);
+            }
+            if (do_t) apply_transformation(k, trans_t, f0, work1, work2, -mufac, result0);
+        }
 
-                long break_even;
-                if (NDIM==1) break_even = long(0.5*twok);
-                else if (NDIM==2) break_even = long(0.6*twok);
-                else if (NDIM==3) break_even=long(0.65*twok);
-                else break_even=long(0.7*twok);
-                bool rank_is_zero = false;
-                for (std::size_t d=0; d<NDIM; ++d) {
-                    long r;
-                    for (r=0; r<twok; ++r) {
-                        if (ops_1d[d]->Rs[r] < tol) break;
-                    }
-                    if (r >= break_even) {
-                        trans[d].r = twok;
-                        trans[d].U = ops_1d[d]->R.ptr();
-                        trans[d].VT = 0;
-                    }
-                    else {
-
-#ifdef USE_GENTENSOR
-                        r = std::max(2L,r+(r&1L)); // (needed for 6D == when GENTENSOR is on) NOLONGER NEED TO FORCE OPERATOR RANK TO BE EVEN
-#endif
-                        if (r == 0) {
-                            rank_is_zero = true;
-                            break;
-                        }
-                        trans[d].r = r;
-                        trans[d].U = ops_1d[d]->RU.ptr();
-                        trans[d].VT = ops_1d[d]->RVT.ptr();
-                    }
-                    trans2[d]=ops_1d[d]->R;
-                }
-
-                if (!rank_is_zero)
-                    apply_transformation(twok, trans, f, work1, work2, mufac, result);
 
-                //            apply_transformation2(n, twok, tol, trans2, f, work1, work2, mufac, result);
-//                apply_transformation3(trans2, f, mufac, result);
-            }
+        /// One separated term and block of a batched apply (see apply_batch)
+        template <typename R>
+        struct BatchTerm {
+            Transformation trans[NDIM];
+            Q mufac;
+            Tensor<R>* result;
+        };
 
-            double Tnorm = 1.0;
-            for (std::size_t d=0; d<NDIM; ++d) Tnorm *= ops_1d[d]->Tnorm;
 
-            if (at.t_term and (Tnorm>0.0)) {
-                tol = tol/(Tnorm*NDIM);  // Errors are relative within here
+        /// Apply a batch of terms that all act on the same input f
 
-                long break_even;
-                if (NDIM==1) break_even = long(0.5*k);
-                else if (NDIM==2) break_even = long(0.6*k);
-                else if (NDIM==3) break_even=long(0.65*k);
-                else break_even=long(0.7*k);
-                bool rank_is_zero = false;
-                for (std::size_t d=0; d<NDIM; ++d) {
-                    long r;
-                    for (r=0; r<k; ++r) {
-                        if (ops_1d[d]->Ts[r] < tol) break;
-                    }
-                    if (r >= break_even) {
-                        trans[d].r = k;
-                        trans[d].U = ops_1d[d]->T.ptr();
-                        trans[d].VT = 0;
+        /// The first transformation of every term contracts the same index
+        /// of f, so the first-dimension matrices of many terms are stacked
+        /// side by side and applied with one large matrix multiplication.
+        /// The remaining dimensions are done term by term.
+        template <typename T, typename R>
+        void apply_transformation_batch(long dimk, const Tensor<T>& f,
+                                        const std::vector< BatchTerm<R> >& terms,
+                                        Tensor<R>& work1, Tensor<R>& work2) const {
+            long dimi = 1;
+            for (std::size_t i=1; i<NDIM; ++i) dimi *= dimk;
+
+            // Limit the stacked result to about 2 MB of doubles
+            const long maxcol = std::max(dimk, (1L<<18)/dimi);
+            Tensor<Q> U(dimk*maxcol);
+            Tensor<R> W(dimi*maxcol);
+
+            std::size_t begin = 0;
+            while (begin < terms.size()) {
+                // Stack the first-dimension matrices (dimk,r) into U(dimk,ncol)
+                std::size_t end = begin;
+                long ncol = 0;
+                while (end < terms.size() && ncol + terms[end].trans[0].r <= maxcol) {
+                    ncol += terms[end].trans[0].r;
+                    ++end;
+                }
+                long col = 0;
+                for (std::size_t t=begin; t<end; ++t) {
+                    const Transformation& tr = terms[t].trans[0];
+                    for (long kk=0; kk<dimk; ++kk) {
+                        for (long j=0; j<tr.r; ++j) U[kk*ncol + col + j] = tr.U[kk*dimk + j];
                     }
-                    else {
+                    col += tr.r;
+                }
 
-#ifdef USE_GENTENSOR
-                        r = std::max(2L,r+(r&1L)); // (needed for 6D == GENTENSOR is USED) NOLONGER NEED TO FORCE OPERATOR RANK TO BE EVEN
-#endif
-                        if (r == 0) {
-                            rank_is_zero = true;
-                            break;
-                        }
-                        trans[d].r = r;
-                        trans[d].U = ops_1d[d]->TU.ptr();
-                        trans[d].VT = ops_1d[d]->TVT.ptr();
+                mTxmq(dimi, ncol, dimk, W.ptr(), f.ptr(), U.ptr());
+
+                col = 0;
+                for (std::size_t t=begin; t<end; ++t) {
+                    const BatchTerm<R>& term = terms[t];
+                    const long r = term.trans[0].r;
+                    R* MADNESS_RESTRICT w1 = work1.ptr();
+                    const R* w = W.ptr() + col;
+                    for (long i=0; i<dimi; ++i) {
+                        for (long j=0; j<r; ++j) w1[i*r + j] = w[i*ncol + j];
                     }
-                    trans2[d]=ops_1d[d]->T;
+                    apply_transformation_tail(dimk, term.trans, work1, work2, term.mufac, *term.result);
+                    col += r;
                 }
-                if (!rank_is_zero)
-                    apply_transformation(k, trans, f0, work1, work2, -mufac, result0);
-//                apply_transformation2(n, k, tol, trans2, f0, work1, work2, -mufac, result0);
-//                apply_transformation3(trans2, f0, -mufac, result0);
+                begin = end;
             }
         }
 
@@ -1030,6 +1121,9 @@ namespace madness {
                 timer_full.print("op full tensor       ");
                 timer_low_transf.print("op low rank transform");
                 timer_low_accumulate.print("op low rank addition ");
+                madness::print("displacement screening");
+                madness::print("  # applied            ", screening->ndone.load());
+                madness::print("  # skipped            ", screening->nskipped.load());
         	}
         }
 
@@ -1038,15 +1132,69 @@ namespace madness {
                 timer_full.reset();
                 timer_low_transf.reset();
                 timer_low_accumulate.reset();
+                screening->ndone = 0;
+                screening->nskipped = 0;
         	}
         }
 
+        /// Accumulates the screening statistics of one source box (see print_timer)
+        void add_screening_stats(unsigned long ndone, unsigned long nskipped) const {
+            screening->ndone.fetch_add(ndone, std::memory_order_relaxed);
+            screening->nskipped.fetch_add(nskipped, std::memory_order_relaxed);
+        }
+
         const BoundaryConditions<NDIM>& get_bc() const {return bc;}
 
         const std::vector< Key<NDIM> >& get_disp(Level n) const {
             return Displacements<NDIM>().get_disp(n, isperiodicsum);
         }
 
+        /// Returns the displacements of level \c n whose norm exceeds \c cutoff, sorted by decreasing norm
+
+        /// The table is built once per level by walking the displacements
+        /// in shells of increasing distance until a whole shell beyond the
+        /// nearest neighbors falls below the cutoff (the same rule do_apply
+        /// used for each box).  A somewhat smaller cutoff than requested is
+        /// used so that boxes with larger coefficients can share the table;
+        /// it is rebuilt if a later request needs a smaller one.
+        /// Returns a null pointer for the modified NS form, where the
+        /// norms also depend on the source box.
+        std::shared_ptr<const DisplacementNorms> get_disp_norms(Level n, double cutoff) const {
+            if (modified() || n < 0 || n >= 64) return std::shared_ptr<const DisplacementNorms>();
+            std::shared_ptr<const DisplacementNorms> p = std::atomic_load(&screening->norms[n]);
+            if (p && p->cutoff <= cutoff) return p;
+
+            ScopedMutex<Mutex> lock(screening->mutex);
+            p = std::atomic_load(&screening->norms[n]);
+            if (p && p->cutoff <= cutoff) return p;
+
+            std::shared_ptr<DisplacementNorms> t(new DisplacementNorms);
+            t->cutoff = 0.1*cutoff;
+            const std::vector< Key<NDIM> >& disp = get_disp(n);
+            int ndone = 1;
+            uint64_t distsq = 99999999999999;
+            for (typename std::vector< Key<NDIM> >::const_iterator it=disp.begin(); it != disp.end(); ++it) {
+                uint64_t dsq = it->distsq();
+                if (dsq != distsq) {
+                    if (ndone == 0 && dsq > 1) break;
+                    ndone = 0;
+                    distsq = dsq;
+                }
+                const double opnorm = getop_ns(n, *it)->norm;
+                if (opnorm > t->cutoff) {
+                    ++ndone;
+                    t->disp.push_back(std::make_pair(*it, opnorm));
+                }
+            }
+            std::stable_sort(t->disp.begin(), t->disp.end(),
+                             [](const std::pair<Key<NDIM>,double>& a, const std::pair<Key<NDIM>,double>& b) {
+                                 return a.second > b.second;
+                             });
+            p = t;
+            std::atomic_store(&screening->norms[n], p);
+            return p;
+        }
+
         /// return the operator norm for all terms, all dimensions and 1 displacement
         double norm(Level n, const Key<NDIM>& d, const Key<NDIM>& source_key) const {
             // SeparatedConvolutionData keeps data for all terms and all dimensions and 1 displacement
@@ -1186,6 +1334,93 @@ namespace madness {
         }
 
 
+        /// apply this operator for many displacements of one source box in full rank
+
+        /// Same as calling apply for each displacement, but all separated
+        /// terms of all displacements that act on the same input block are
+        /// applied together (see apply_transformation_batch).
+        /// @param[in]  source  the source key
+        /// @param[in]  shifts  the displacements
+        /// @param[in]  coeff   source coeffs in full rank
+        /// @param[in]  tol     thresh/#neigh*cnorm
+        /// @return     the results op(coeff) for each displacement
+        template <typename T>
+        std::vector< Tensor<TENSOR_RESULT_TYPE(T,Q)> >
+        apply_batch(const Key<NDIM>& source,
+                    const std::vector< Key<NDIM> >& shifts,
+                    const Tensor<T>& coeff,
+                    double tol) const {
+            MADNESS_ASSERT(coeff.ndim()==NDIM);
+
+            double cpu0=cpu_time();
+
+            typedef TENSOR_RESULT_TYPE(T,Q) resultT;
+            const Tensor<T>* input = &coeff;
+            Tensor<T> dummy;
+
+            if (not modified()) {
+                if (coeff.dim(0) == k) {
+                    // Leaf node with only scaling coefficients (see apply)
+                    dummy = Tensor<T>(v2k);
+                    dummy(s0) = coeff;
+                    input = &dummy;
+                }
+                else {
+                    MADNESS_ASSERT(coeff.dim(0)==2*k);
+                }
+            }
+
+            tol = 0.01*tol/rank; // Error is per separated term
+            ApplyTerms at;
+            at.r_term=true;
+            at.t_term=(source.level()>0);
+
+            const std::size_t nshift = shifts.size();
+            std::vector< Tensor<resultT> > r(nshift), r0(nshift);
+            std::vector< BatchTerm<resultT> > rterms, tterms;
+            for (std::size_t i=0; i<nshift; ++i) {
+                r[i] = Tensor<resultT>(modified() ? vk : v2k);
+                r0[i] = Tensor<resultT>(vk);
+                const SeparatedConvolutionData<Q,NDIM>* op = getop(source.level(), shifts[i], source);
+                for (int mu=0; mu<rank; ++mu) {
+                    const SeparatedConvolutionInternal<Q,NDIM>& muop =  op->muops[mu];
+                    if (muop.norm > tol) {
+                        Q fac = ops[mu].getfac();
+                        BatchTerm<resultT> rt, tt;
+                        bool do_r, do_t;
+                        make_muop_transformations(at, muop.ops, tol/std::abs(fac),
+                                                  rt.trans, do_r, tt.trans, do_t);
+                        if (do_r) {
+                            rt.mufac = fac;
+                            rt.result = &r[i];
+                            rterms.push_back(rt);
+                        }
+                        if (do_t) {
+                            tt.mufac = -fac;
+                            tt.result = &r0[i];
+                            tterms.push_back(tt);
+                        }
+                    }
+                }
+            }
+
+            Tensor<resultT> work1(modified() ? vk : v2k,false), work2(modified() ? vk : v2k,false);
+            if (rterms.size()) {
+                apply_transformation_batch(modified() ? k : 2*k, *input, rterms, work1, work2);
+            }
+            if (tterms.size()) {
+                const Tensor<T> f0 = copy(coeff(s0));
+                apply_transformation_batch(k, f0, tterms, work1, work2);
+            }
+
+            for (std::size_t i=0; i<nshift; ++i) r[i](s0).gaxpy(1.0,r0[i],1.0);
+            double cpu1=cpu_time();
+            timer_full.accumulate(cpu1-cpu0);
+
+            return r;
+        }
+
+
         /// apply this operator on only 1 particle of the coefficients in low rank form
 
         /// note the unfortunate mess with NDIM: here NDIM is the operator dimension, and FDIM is the
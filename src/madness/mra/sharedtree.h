@@ -0,0 +1,379 @@
+/*
+  This file is part of MADNESS.
+
+  Copyright (C) 2007,2010 Oak Ridge National Laboratory
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+
+  For more information please contact:
+
+  Robert J. Harrison
+  Oak Ridge National Laboratory
+  One Bethel Valley Road
+  P.O. Box 2008, MS-6367
+
+  email: harrisonrj@ornl.gov
+  tel:   865-241-3937
+  fax:   865-572-0680
+
+  $Id$
+*/
+#ifndef MADNESS_MRA_SHAREDTREE_H__INCLUDED
+#define MADNESS_MRA_SHAREDTREE_H__INCLUDED
+
+/// \file mra/sharedtree.h
+/// \brief Sets of functions on a common tree stored as one coefficient slab per box
+
+/// Orbitals refined to a common tree (see refine_to_common_level) carry
+/// identical keys and node flags in every FunctionImpl.  A
+/// SharedTreeFunctions stores such a set in a single container whose
+/// leaves hold a [nfunc, k^NDIM] slab with the scaling function
+/// coefficients of all functions:
+/// \code
+///   refine_to_common_level(world, orbitals);
+///   SharedTreeFunctions<double,3> phi(world, orbitals);
+///   Tensor<double> S = matrix_inner(world, phi, phi);   // one GEMM per box
+///   SharedTreeFunctions<double,3> psi = transform(world, phi, U);
+///   std::vector<real_function_3d> result = psi.to_functions();
+/// \endcode
+/// The keys, hash table and node flags are thus stored once instead of
+/// nfunc times, and the batched kernels below work on whole slabs.  Only
+/// the reconstructed form on the fixed tree is represented; anything
+/// that changes the tree has to go through to_functions().
+
+#include <madness/mra/mra.h>
+#include <vector>
+
+namespace madness {
+
+    /// A box of a SharedTreeFunctions
+    template <typename T, std::size_t NDIM>
+    class SharedTreeNode {
+        Tensor<T> _slab;        ///< Row i holds the coefficients of function i (leaves only)
+        bool _has_children;
+
+    public:
+        SharedTreeNode() : _slab(), _has_children(false) {}
+
+        SharedTreeNode(const Tensor<T>& slab, bool has_children)
+            : _slab(slab), _has_children(has_children) {}
+
+        bool has_children() const { return _has_children; }
+
+        bool is_leaf() const { return !_has_children; }
+
+        /// Returns the [nfunc, k^NDIM] coefficients, empty in interior boxes
+        const Tensor<T>& slab() const { return _slab; }
+
+        Tensor<T>& slab() { return _slab; }
+
+        template <typename Archive>
+        void serialize(Archive& ar) { ar & _slab & _has_children; }
+    };
+
+
+    /// A set of functions sharing one tree, in reconstructed form
+    template <typename T, std::size_t NDIM>
+    class SharedTreeFunctions {
+    public:
+        typedef Key<NDIM> keyT;
+        typedef SharedTreeNode<T,NDIM> nodeT;
+        typedef WorldContainer<keyT,nodeT> dcT;
+        typedef std::shared_ptr< WorldDCPmapInterface<keyT> > pmapT;
+
+    private:
+        World* _world;
+        dcT _nodes;
+        long _nfunc;
+        int _k;
+        double _thresh;
+
+        static std::vector<long> box_dims(int k) { return std::vector<long>(NDIM,k); }
+
+    public:
+        SharedTreeFunctions() : _world(nullptr), _nodes(), _nfunc(0), _k(0), _thresh(0.0) {}
+
+        /// Makes a set of \c nfunc functions without any boxes ... collective
+        SharedTreeFunctions(World& world, long nfunc, int k, double thresh, const pmapT& pmap)
+            : _world(&world), _nodes(world, pmap), _nfunc(nfunc), _k(k), _thresh(thresh) {}
+
+        /// Gathers the coefficients of \c v into slabs ... collective
+
+        /// The functions must be reconstructed, share wavelet order and
+        /// process map, and have identical trees, i.e. have been passed
+        /// together to refine_to_common_level.  \c v is left unchanged.
+        SharedTreeFunctions(World& world, const std::vector< Function<T,NDIM> >& v, bool fence=true)
+            : _world(&world), _nodes(), _nfunc(v.size()), _k(0), _thresh(0.0)
+        {
+            MADNESS_CHECK(!v.empty());
+            std::vector<const FunctionImpl<T,NDIM>*> impl(v.size());
+            for (std::size_t i=0; i<v.size(); ++i) {
+                impl[i] = v[i].get_impl().get();
+                MADNESS_CHECK(impl[i]->is_reconstructed());
+                MADNESS_CHECK(impl[i]->get_k() == impl[0]->get_k());
+                MADNESS_CHECK(impl[i]->get_pmap() == impl[0]->get_pmap());
+            }
+            _k = impl[0]->get_k();
+            _thresh = impl[0]->get_thresh();
+            _nodes = dcT(world, impl[0]->get_pmap());
+
+            const typename FunctionImpl<T,NDIM>::dcT& coeffs0 = impl[0]->get_coeffs();
+            const long size = std::pow(long(_k), long(NDIM));
+            for (auto it=coeffs0.begin(); it!=coeffs0.end(); ++it) {
+                const keyT& key = it->first;
+                const bool has_children = it->second.has_children();
+                Tensor<T> slab;
+                if (!has_children) slab = Tensor<T>(_nfunc, size);
+                for (long i=0; i<_nfunc; ++i) {
+                    const auto& coeffs = impl[i]->get_coeffs();
+                    auto jt = coeffs.find(key).get();
+                    if (jt == coeffs.end() || jt->second.has_children() != has_children ||
+                        (!has_children && !jt->second.has_coeff()))
+                        MADNESS_EXCEPTION("SharedTreeFunctions: functions are not on a common tree", i);
+                    if (!has_children) {
+                        const Tensor<T> c = jt->second.coeff().full_tensor();
+                        slab(i,_) = (c.iscontiguous() ? c : copy(c)).reshape(size);
+                    }
+                }
+                _nodes.replace(key, nodeT(slab, has_children));
+            }
+            for (long i=1; i<_nfunc; ++i) {
+                if (impl[i]->get_coeffs().size() != coeffs0.size())
+                    MADNESS_EXCEPTION("SharedTreeFunctions: functions are not on a common tree", i);
+            }
+            if (fence) world.gop.fence();
+        }
+
+        /// Scatters the slabs into separate functions ... collective
+        std::vector< Function<T,NDIM> > to_functions(bool fence=true) const {
+            typedef FunctionNode<T,NDIM> fnodeT;
+            typedef typename FunctionImpl<T,NDIM>::coeffT coeffT;
+
+            std::vector< Function<T,NDIM> > v(_nfunc);
+            for (auto& f : v) {
+                f = FunctionFactory<T,NDIM>(world()).k(_k).thresh(_thresh).pmap(get_pmap()).empty().fence(false);
+            }
+            const std::vector<long> dims = box_dims(_k);
+            for (auto it=_nodes.begin(); it!=_nodes.end(); ++it) {
+                const nodeT& node = it->second;
+                for (long i=0; i<_nfunc; ++i) {
+                    coeffT c;
+                    if (node.is_leaf()) c = coeffT(copy(node.slab()(i,_)).reshape(dims));
+                    v[i].get_impl()->get_coeffs().replace(it->first, fnodeT(c, node.has_children()));
+                }
+            }
+            if (fence) world().gop.fence();
+            return v;
+        }
+
+        /// Makes a set of \c nfunc functions on the same tree but without coefficients ... collective
+        template <typename R>
+        SharedTreeFunctions<R,NDIM> empty_like(long nfunc) const {
+            return SharedTreeFunctions<R,NDIM>(world(), nfunc, _k, _thresh, get_pmap());
+        }
+
+        World& world() const { MADNESS_ASSERT(_world); return *_world; }
+
+        /// Returns the number of functions
+        long nfunc() const { return _nfunc; }
+
+        int get_k() const { return _k; }
+
+        double thresh() const { return _thresh; }
+
+        const pmapT& get_pmap() const { return _nodes.get_pmap(); }
+
+        /// Returns the container of boxes, for kernels working directly on the slabs
+        dcT& get_nodes() { return _nodes; }
+
+        const dcT& get_nodes() const { return _nodes; }
+    };
+
+
+    namespace detail {
+
+        template <typename T, typename R, std::size_t NDIM>
+        struct shared_tree_transform_op {
+            typedef TENSOR_RESULT_TYPE(T,R) resultT;
+            typedef Range<typename SharedTreeFunctions<T,NDIM>::dcT::const_iterator> rangeT;
+
+            SharedTreeFunctions<resultT,NDIM>* result;
+            const Tensor<R>* c;
+
+            shared_tree_transform_op() : result(nullptr), c(nullptr) {}
+            shared_tree_transform_op(SharedTreeFunctions<resultT,NDIM>* result, const Tensor<R>* c)
+                : result(result), c(c) {}
+
+            bool operator()(typename rangeT::iterator& it) const {
+                const SharedTreeNode<T,NDIM>& node = it->second;
+                Tensor<resultT> slab;
+                if (node.is_leaf()) slab = inner(*c, node.slab(), 0, 0);
+                result->get_nodes().replace(it->first, SharedTreeNode<resultT,NDIM>(slab, node.has_children()));
+                return true;
+            }
+
+            template <typename Archive> void serialize(const Archive& ar) {
+                throw "NOT IMPLEMENTED";
+            }
+        };
+
+        template <typename T, typename R, std::size_t NDIM>
+        struct shared_tree_inner_op {
+            typedef TENSOR_RESULT_TYPE(T,R) resultT;
+            typedef Range<typename SharedTreeFunctions<T,NDIM>::dcT::const_iterator> rangeT;
+
+            const SharedTreeFunctions<R,NDIM>* g;
+
+            shared_tree_inner_op() : g(nullptr) {}
+            shared_tree_inner_op(const SharedTreeFunctions<R,NDIM>* g) : g(g) {}
+
+            Tensor<resultT> operator()(typename rangeT::iterator& it) const {
+                const SharedTreeNode<T,NDIM>& fnode = it->second;
+                if (fnode.has_children()) return Tensor<resultT>();
+                const auto& gnodes = g->get_nodes();
+                auto jt = gnodes.find(it->first).get();
+                if (jt == gnodes.end() || jt->second.has_children())
+                    MADNESS_EXCEPTION("matrix_inner: SharedTreeFunctions are not on the same tree", 0);
+                const Tensor<T>& f = fnode.slab();
+                return inner(TensorTypeData<T>::iscomplex ? conj(f) : f, jt->second.slab(), 1, 1);
+            }
+
+            Tensor<resultT> operator()(const Tensor<resultT>& a, const Tensor<resultT>& b) const {
+                if (a.size() == 0) return b;
+                if (b.size() == 0) return a;
+                return a + b;
+            }
+
+            template <typename Archive> void serialize(const Archive& ar) {
+                throw "NOT IMPLEMENTED";
+            }
+        };
+
+        template <typename T, typename R, std::size_t NDIM>
+        struct shared_tree_mul_op {
+            typedef TENSOR_RESULT_TYPE(T,R) resultT;
+            typedef Range<typename SharedTreeFunctions<R,NDIM>::dcT::const_iterator> rangeT;
+
+            const FunctionImpl<T,NDIM>* a;
+            SharedTreeFunctions<resultT,NDIM>* result;
+
+            shared_tree_mul_op() : a(nullptr), result(nullptr) {}
+            shared_tree_mul_op(const FunctionImpl<T,NDIM>* a, SharedTreeFunctions<resultT,NDIM>* result)
+                : a(a), result(result) {}
+
+            bool operator()(typename rangeT::iterator& it) const {
+                const Key<NDIM>& key = it->first;
+                const SharedTreeNode<R,NDIM>& node = it->second;
+                Tensor<resultT> slab;
+                if (node.is_leaf()) {
+                    auto jt = a->get_coeffs().find(key).get();
+                    if (jt == a->get_coeffs().end() || !jt->second.has_coeff() || jt->second.has_children())
+                        MADNESS_EXCEPTION("mul: function is not on the tree of the SharedTreeFunctions", 0);
+
+                    // Values of all functions at the quadrature points: the
+                    // leading (function) index is left alone.  Of the scale
+                    // factors of coeffs2values and values2coeffs one remains.
+                    const FunctionCommonData<T,NDIM>& cdata = FunctionCommonData<T,NDIM>::get(a->get_k());
+                    const long n = node.slab().dim(0), k = a->get_k();
+                    std::vector<long> dims(NDIM+1,k);
+                    dims[0] = n;
+                    Tensor<R> v = node.slab().reshape(dims);
+                    for (std::size_t d=1; d<=NDIM; ++d) v = transform_dir(v, cdata.quad_phit, d);
+
+                    const Tensor<T> avals = transform(jt->second.coeff().full_tensor(), cdata.quad_phit);
+                    Tensor<resultT> prod(NDIM+1, &dims[0], false);
+                    const long npt = avals.size();
+                    const double scale = pow(2.0,0.5*NDIM*key.level())/sqrt(FunctionDefaults<NDIM>::get_cell_volume());
+                    const T* pa = avals.ptr();
+                    for (long i=0; i<n; ++i) {
+                        const R* pv = v.ptr() + i*npt;
+                        resultT* pp = prod.ptr() + i*npt;
+                        for (long p=0; p<npt; ++p) pp[p] = scale*pa[p]*pv[p];
+                    }
+                    for (std::size_t d=1; d<=NDIM; ++d) prod = transform_dir(prod, cdata.quad_phiw, d);
+                    slab = prod.reshape(n, npt);
+                }
+                result->get_nodes().replace(key, SharedTreeNode<resultT,NDIM>(slab, node.has_children()));
+                return true;
+            }
+
+            template <typename Archive> void serialize(const Archive& ar) {
+                throw "NOT IMPLEMENTED";
+            }
+        };
+
+    } // namespace detail
+
+
+    /// Transforms a set of functions on a shared tree ... result[i] = sum(j) v[j]*c(j,i)
+
+    /// One matrix product per leaf box.
+    template <typename T, typename R, std::size_t NDIM>
+    SharedTreeFunctions<TENSOR_RESULT_TYPE(T,R),NDIM>
+    transform(World& world, const SharedTreeFunctions<T,NDIM>& v, const Tensor<R>& c, bool fence=true) {
+        PROFILE_BLOCK(Vtransform_shared);
+        typedef TENSOR_RESULT_TYPE(T,R) resultT;
+        typedef detail::shared_tree_transform_op<T,R,NDIM> opT;
+        MADNESS_ASSERT(c.ndim() == 2 && c.dim(0) == v.nfunc());
+
+        SharedTreeFunctions<resultT,NDIM> result = v.template empty_like<resultT>(c.dim(1));
+        world.taskq.for_each<typename opT::rangeT,opT>(
+                typename opT::rangeT(v.get_nodes().begin(), v.get_nodes().end()), opT(&result, &c)).get();
+        if (fence) world.gop.fence();
+        return result;
+    }
+
+    /// Computes the matrix of inner products ... result(i,j) = <f[i]|g[j]>
+
+    /// The sets must be on the same tree.  One matrix product per leaf box.
+    template <typename T, typename R, std::size_t NDIM>
+    Tensor<TENSOR_RESULT_TYPE(T,R)>
+    matrix_inner(World& world, const SharedTreeFunctions<T,NDIM>& f, const SharedTreeFunctions<R,NDIM>& g) {
+        PROFILE_BLOCK(Vmatrix_inner_shared);
+        typedef TENSOR_RESULT_TYPE(T,R) resultT;
+        typedef detail::shared_tree_inner_op<T,R,NDIM> opT;
+        MADNESS_CHECK(f.get_pmap() == g.get_pmap() && f.get_k() == g.get_k());
+
+        Tensor<resultT> r = world.taskq.reduce<Tensor<resultT>,typename opT::rangeT,opT>(
+                typename opT::rangeT(f.get_nodes().begin(), f.get_nodes().end()), opT(&g)).get();
+        if (r.size() == 0) r = Tensor<resultT>(f.nfunc(), g.nfunc());
+        world.gop.sum(r.ptr(), r.size());
+        return r;
+    }
+
+    /// Multiplies each function of a shared-tree set by \c a ... result[i] = a*v[i]
+
+    /// \c a must be reconstructed with leaves on the tree of \c v (e.g.,
+    /// refined to a common level together with the functions of \c v).
+    /// The product is projected on that tree without further refinement.
+    template <typename T, typename R, std::size_t NDIM>
+    SharedTreeFunctions<TENSOR_RESULT_TYPE(T,R),NDIM>
+    mul(World& world, const Function<T,NDIM>& a, const SharedTreeFunctions<R,NDIM>& v, bool fence=true) {
+        PROFILE_BLOCK(Vmul_shared);
+        typedef TENSOR_RESULT_TYPE(T,R) resultT;
+        typedef detail::shared_tree_mul_op<T,R,NDIM> opT;
+        MADNESS_CHECK(a.is_reconstructed() && a.k() == v.get_k() && a.get_pmap() == v.get_pmap());
+
+        SharedTreeFunctions<resultT,NDIM> result = v.template empty_like<resultT>(v.nfunc());
+        world.taskq.for_each<typename opT::rangeT,opT>(
+                typename opT::rangeT(v.get_nodes().begin(), v.get_nodes().end()),
+                opT(a.get_impl().get(), &result)).get();
+        if (fence) world.gop.fence();
+        return result;
+    }
+
+} // namespace madness
+
+#endif // MADNESS_MRA_SHAREDTREE_H__INCLUDED
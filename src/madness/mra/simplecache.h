@@ -34,6 +34,8 @@
 #define MADNESS_MRA_SIMPLECACHE_H__INCLUDED
 
 #include <madness/mra/key.h>
+#include <madness/world/worldmutex.h>
+#include <atomic>
 
 namespace madness {
     /// Simplified interface around hash_map to cache stuff for 1D
@@ -41,31 +43,113 @@ namespace madness {
     /// This is a write once cache --- subsequent writes of elements
     /// have no effect (so that pointers/references to cached data
     /// cannot be invalidated)
+    ///
+    /// Since entries are never modified or removed the cache is an
+    /// open-addressed table of pointers to the entries, published with
+    /// release stores.  Readers take no lock, they only need acquire
+    /// loads.  Writers are serialized by a mutex.  When the table grows
+    /// the pointers are copied into a new, larger table and the old
+    /// table is retained (until the cache is destroyed) for readers
+    /// that might still be probing it.
     template <typename Q, std::size_t NDIM>
     class SimpleCache {
     private:
-        typedef ConcurrentHashMap< Key<NDIM>, Q > mapT;
         typedef std::pair<Key<NDIM>, Q> pairT;
-        mapT cache;
+
+        struct Table {
+            const std::size_t mask;             ///< Number of slots - 1 (power of 2)
+            std::atomic<const pairT*>* slots;
+            Table* prev;                        ///< Previous (smaller) table
+
+            Table(std::size_t nslot, Table* prev)
+                : mask(nslot-1), slots(new std::atomic<const pairT*>[nslot]), prev(prev)
+            {
+                for (std::size_t i=0; i<nslot; ++i) slots[i].store(0, std::memory_order_relaxed);
+            }
+
+            ~Table() {
+                delete [] slots;
+                delete prev;
+            }
+
+            /// Probe for key ... returns the slot holding it or the first empty slot
+            std::atomic<const pairT*>& probe(const Key<NDIM>& key) const {
+                for (std::size_t i=key.hash()&mask; ; i=(i+1)&mask) {
+                    const pairT* p = slots[i].load(std::memory_order_acquire);
+                    if (!p || p->first == key) return slots[i];
+                }
+            }
+        };
+
+        std::atomic<Table*> table;  ///< Current table (null if empty)
+        std::size_t nentry;         ///< Number of entries ... only accessed by writers
+        Mutex mutex;                ///< Serializes writers
+
+        /// Insert a new entry ... caller holds the mutex and checked that key is absent
+        void insert(const pairT* p) {
+            Table* t = table.load(std::memory_order_relaxed);
+            if (!t || 2*(nentry+1) > t->mask+1) {
+                // Keep the load factor below 1/2 so that probes are short
+                Table* tnew = new Table(t ? 2*(t->mask+1) : 16, t);
+                if (t) {
+                    for (std::size_t i=0; i<=t->mask; ++i) {
+                        const pairT* q = t->slots[i].load(std::memory_order_relaxed);
+                        if (q) tnew->probe(q->first).store(q, std::memory_order_relaxed);
+                    }
+                }
+                table.store(tnew, std::memory_order_release);
+                t = tnew;
+            }
+            t->probe(p->first).store(p, std::memory_order_release);
+            ++nentry;
+        }
+
+        void copy_from(const SimpleCache& c) {
+            const Table* t = c.table.load(std::memory_order_acquire);
+            if (!t) return;
+            for (std::size_t i=0; i<=t->mask; ++i) {
+                const pairT* q = t->slots[i].load(std::memory_order_acquire);
+                if (q) insert(new pairT(*q));
+            }
+        }
+
+        /// Not thread safe
+        void clear() {
+            Table* t = table.load(std::memory_order_relaxed);
+            if (!t) return;
+            for (std::size_t i=0; i<=t->mask; ++i) delete t->slots[i].load(std::memory_order_relaxed);
+            delete t;
+            table.store(0, std::memory_order_relaxed);
+            nentry = 0;
+        }
 
     public:
-        SimpleCache() : cache() {};
+        SimpleCache() : table(0), nentry(0) {};
 
-        SimpleCache(const SimpleCache& c) : cache(c.cache) {};
+        SimpleCache(const SimpleCache& c) : table(0), nentry(0) {
+            ScopedMutex<Mutex> lock(mutex);
+            copy_from(c);
+        };
 
         SimpleCache& operator=(const SimpleCache& c) {
             if (this != &c) {
-                cache.clear();
-                cache = c.cache;
+                ScopedMutex<Mutex> lock(mutex);
+                clear();
+                copy_from(c);
             }
             return *this;
         }
 
+        ~SimpleCache() {
+            clear();
+        }
+
         /// If key is present return pointer to cached value, otherwise return NULL
         inline const Q* getptr(const Key<NDIM>& key) const {
-            typename mapT::const_iterator test = cache.find(key);
-            if (test == cache.end()) return 0;
-            return &(test->second);
+            const Table* t = table.load(std::memory_order_acquire);
+            if (!t) return 0;
+            const pairT* p = t->probe(key).load(std::memory_order_acquire);
+            return p ? &(p->second) : 0;
         }
 
 
@@ -89,7 +173,9 @@ namespace madness {
 
         /// Set value associated with key ... gives ownership of a new copy to the container
         inline void set(const Key<NDIM>& key, const Q& val) {
-            cache.insert(pairT(key,val));
+            ScopedMutex<Mutex> lock(mutex);
+            if (getptr(key)) return;
+            insert(new pairT(key,val));
         }
 
         inline void set(Level n, Translation l, const Q& val) {
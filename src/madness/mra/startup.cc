@@ -132,6 +132,8 @@ namespace madness {
         // This to init static data while single threaded
         initialize_legendre_stuff();
 
+        ConvolutionDiskCache::initialize(world);
+
         //if (world.rank() == 0) print("testing coeffs, etc.");
         MADNESS_CHECK(gauss_legendre_test());
         MADNESS_CHECK(test_two_scale_coefficients());
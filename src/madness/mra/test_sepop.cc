@@ -39,6 +39,78 @@ using std::max;
 namespace madness {
     using std::abs;
 
+    namespace {
+        typedef SimpleCache<Tensor<double>,3> test_cacheT;
+
+        long simplecache_insert(test_cacheT* cache, const std::vector< Key<3> >* keys, int first, int stride) {
+            long nfound = 0;
+            for (std::size_t i=first; i<keys->size(); i+=stride) {
+                cache->set((*keys)[i], Tensor<double>(1).fill(double(i)));
+                if (cache->getptr((*keys)[i-first])) ++nfound;
+            }
+            return nfound;
+        }
+
+        long simplecache_lookup(const test_cacheT* cache, const std::vector< Key<3> >* keys, int nrep) {
+            long nfound = 0;
+            for (int rep=0; rep<nrep; ++rep) {
+                for (std::size_t i=0; i<keys->size(); ++i) {
+                    if (cache->getptr((*keys)[i])) ++nfound;
+                }
+            }
+            return nfound;
+        }
+    }
+
+    /// Checks the write-once cache of the operator data under concurrent use and times the lookups
+    bool test_simplecache(World& world) {
+        std::vector< Key<3> > keys;
+        for (Level n=0; n<8; ++n) {
+            for (Translation x=-4; x<=4; ++x) {
+                for (Translation y=-4; y<=4; ++y) {
+                    for (Translation z=-4; z<=4; ++z) {
+                        Vector<Translation,3> l;
+                        l[0] = x; l[1] = y; l[2] = z;
+                        keys.push_back(Key<3>(n,l));
+                    }
+                }
+            }
+        }
+
+        // Concurrent inserts (each key twice) mixed with lookups
+        test_cacheT cache;
+        const int ntask = ThreadPool::size() + 1;
+        std::vector< Future<long> > f;
+        for (int i=0; i<2*ntask; ++i) {
+            f.push_back(world.taskq.add(simplecache_insert, &cache, &keys, i%ntask, ntask));
+        }
+        world.taskq.fence();
+
+        bool ok = true;
+        for (std::size_t i=0; i<keys.size(); ++i) {
+            const Tensor<double>* p = cache.getptr(keys[i]);
+            if (!p || (*p)(0L) != double(i)) ok = false;
+        }
+        test_cacheT cache2(cache);
+        if (!cache2.getptr(keys.back())) ok = false;
+
+        // Time lookups from all threads
+        const int nrep = 100;
+        f.clear();
+        double start = wall_time();
+        for (int i=0; i<ntask; ++i) f.push_back(world.taskq.add(simplecache_lookup, &cache, &keys, nrep));
+        world.taskq.fence();
+        double used = wall_time() - start;
+        long nfound = 0;
+        for (int i=0; i<ntask; ++i) nfound += f[i].get();
+        if (nfound != long(ntask)*nrep*keys.size()) ok = false;
+
+        if (world.rank() == 0) {
+            print("SimpleCache:", ntask, "threads", nfound, "lookups in", used, "s", double(nfound)/used, "lookups/s");
+        }
+        return ok;
+    }
+
     bool test_rnlp() {
         long i, n, l;
         Tensor<double> r;
@@ -186,6 +186,20 @@ int test_deferred(World& universe, const std::vector<real_function_3d>& v3,
     return success;
 }
 
+int test_distributed(World& universe, const std::vector<real_function_3d>& v3,
+                   const std::vector<real_function_3d>& ref) {
+    if (universe.rank() == 0) print("\nstarting deferred execution with distributed scheduler");
+    auto taskq = std::shared_ptr<MacroTaskQ>(new MacroTaskQ(universe, universe.size()));
+    taskq->set_printlevel(3);
+    taskq->set_scheduler(MacroTaskQ::Distributed);
+    MicroTask t;
+    MacroTask task(universe, t, taskq);
+    std::vector<real_function_3d> f2a = task(v3[0], 2.0, v3);
+    taskq->run_all();
+    int success=check_vector(universe,ref,f2a,"test_distributed execution of task");
+    return success;
+}
+
 int test_twice(World& universe, const std::vector<real_function_3d>& v3,
                   const std::vector<real_function_3d>& ref) {
     if (universe.rank() == 0) print("\nstarting Microtask twice (check caching)\n");
@@ -264,6 +278,9 @@ int main(int argc, char **argv) {
         success+=test_deferred(universe,v3,ref);
         timer1.tag("deferred taskq execution");
 
+        success+=test_distributed(universe,v3,ref);
+        timer1.tag("distributed scheduler execution");
+
         success+=test_twice(universe,v3,ref);
         timer1.tag("executing a task twice");
 
@@ -41,6 +41,7 @@
 #include <cstdio>
 #include <madness/constants.h>
 #include <madness/mra/qmprop.h>
+#include <madness/mra/checkpoint.h>
 
 #include <madness/misc/ran.h>
 
@@ -670,6 +671,7 @@ int test_diff(World& world) {
 
 namespace madness {
     extern bool test_rnlp();
+    extern bool test_simplecache(World& world);
 }
 
 template <typename T, std::size_t NDIM>
@@ -686,6 +688,13 @@ int test_op(World& world) {
     	else print("test_rnlp              FAIL");
     }
 
+    bool cache_ok=test_simplecache(world);
+    if (world.rank()==0) {
+    	if (cache_ok) print("test_simplecache       OK");
+    	else print("test_simplecache       FAIL");
+    }
+    ok = ok && cache_ok;
+
     typedef Vector<double,NDIM> coordT;
     typedef std::shared_ptr< FunctionFunctorInterface<T,NDIM> > functorT;
 
@@ -1230,6 +1239,143 @@ int test_io(World& world) {
     return 1;
 }
 
+template <typename T, std::size_t NDIM>
+int test_io_async(World& world) {
+    if (world.rank() == 0) {
+        print("\nTest asynchronous IO - type =", archive::get_type_name<T>(),", ndim =",NDIM,"\n");
+    }
+    bool ok=true;
+    typedef Vector<double,NDIM> coordT;
+    typedef std::shared_ptr< FunctionFunctorInterface<T,NDIM> > functorT;
+
+    FunctionDefaults<NDIM>::set_k(5);
+    FunctionDefaults<NDIM>::set_thresh(1e-10); // We want lots of boxes
+    FunctionDefaults<NDIM>::set_truncate_mode(0);
+    FunctionDefaults<NDIM>::set_refine(true);
+    FunctionDefaults<NDIM>::set_initial_level(3);
+    FunctionDefaults<NDIM>::set_cubic_cell(-10,10);
+
+    const coordT origin(0.0);
+    const double expnt = 10.0;
+    const double coeff = pow(2.0/PI,0.25*NDIM);
+    functorT functor(new Gaussian<T,NDIM>(origin, expnt, coeff));
+    Function<T,NDIM> f = FunctionFactory<T,NDIM>(world).functor(functor);
+    const double fnorm = f.norm2();
+    const double fsize = f.size();
+
+    const CheckpointCompression compression[3] = {CheckpointCompression::None,
+                                                  CheckpointCompression::Lossless,
+                                                  CheckpointCompression::Lossy};
+    const double tol = 1e-8;
+    for (int i=0; i<3; ++i) {
+        // Modifying f while the write is in progress must not change the checkpoint
+        CheckpointHandle handle = save_async(f, "jane", compression[i], tol);
+        f.scale(2.0);
+        handle.wait(world);
+        f.scale(0.5);
+
+        Function<T,NDIM> g;
+        if (i == 0) {
+            // Readable as an ordinary parallel archive
+            archive::ParallelInputArchive<archive::BinaryFstreamInputArchive> in(world, "jane");
+            in & g;
+        }
+        else {
+            load_checkpoint(world, g, "jane");
+        }
+        double err = (g-f).norm2();
+        if (world.rank() == 0) print("compression", i, "err = ", err);
+        if (i < 2) {
+            CHECK(err,1e-12*fnorm,"test_io_async");
+        }
+        else {
+            CHECK(err,std::sqrt(fsize)*tol,"test_io_async lossy");
+        }
+    }
+
+    std::vector< Function<T,NDIM> > v(2);
+    v[0] = f;
+    v[1] = 2.0*f;
+    save_async(v, "jane", CheckpointCompression::Lossless).wait(world);
+    std::vector< Function<T,NDIM> > w;
+    load_checkpoint(world, w, "jane");
+    double err = (w.size() == 2) ? (w[1]-v[1]).norm2() : 1.0;
+    CHECK(err,1e-12*fnorm,"test_io_async vector");
+    archive::ParallelInputArchive<archive::BinaryFstreamInputArchive>::remove(world, "jane");
+
+    if (world.rank() == 0) print("test_io_async OK");
+    world.gop.fence();
+    if (ok) return 0;
+    return 1;
+}
+
+template <typename T, std::size_t NDIM>
+int test_low_precision(World& world) {
+    if (world.rank() == 0) {
+        print("\nTest single precision storage - type =", archive::get_type_name<T>(),", ndim =",NDIM,"\n");
+    }
+    bool ok=true;
+    typedef Vector<double,NDIM> coordT;
+    typedef std::shared_ptr< FunctionFunctorInterface<T,NDIM> > functorT;
+
+    FunctionDefaults<NDIM>::set_k(8);
+    FunctionDefaults<NDIM>::set_thresh(1e-10);
+    FunctionDefaults<NDIM>::set_truncate_mode(0);
+    FunctionDefaults<NDIM>::set_refine(true);
+    FunctionDefaults<NDIM>::set_initial_level(3);
+    FunctionDefaults<NDIM>::set_cubic_cell(-10,10);
+
+    const coordT origin(0.0);
+    const double expnt = 10.0;
+    const double coeff = pow(2.0/PI,0.25*NDIM);
+    functorT functor(new Gaussian<T,NDIM>(origin, expnt, coeff));
+    Function<T,NDIM> f = FunctionFactory<T,NDIM>(world).functor(functor);
+    Function<T,NDIM> g = copy(f);
+    const double fnorm = f.norm2();
+    const std::size_t nnode = f.tree_size();
+
+    double ttt, sss;
+    const double tol[3] = {1e-6, 1e-3, 1e-1};
+    for (int i=0; i<3; ++i) {
+        Function<T,NDIM> h = copy(f);
+        const std::size_t full_size = h.get_impl()->real_size();
+        START_TIMER;
+        h.demote(tol[i]*fnorm);
+        END_TIMER("demote");
+        const std::size_t low_size = h.get_impl()->real_size();
+        h.print_size("demoted");
+
+        // the first access promotes the coefficients
+        START_TIMER;
+        double err = (h-g).norm2();
+        END_TIMER("promote and subtract");
+        START_TIMER;
+        double err2 = (h-g).norm2();
+        END_TIMER("subtract");
+
+        if (world.rank() == 0) print("tol", tol[i]*fnorm, "size", full_size, low_size, "err", err, err2);
+        CHECK(err,1e-7*tol[i]*fnorm*std::sqrt(double(nnode)),"test_low_precision error");
+        CHECK(std::abs(err-err2),1e-14*fnorm,"test_low_precision promote");
+        CHECK(double(low_size>full_size),0.5,"test_low_precision size");
+    }
+
+    // truncation applies the default tolerance
+    FunctionDefaults<NDIM>::set_low_precision_tol(1e-3*fnorm);
+    const std::size_t full_size = f.get_impl()->real_size();
+    f.truncate();
+    const std::size_t low_size = f.get_impl()->real_size();
+    FunctionDefaults<NDIM>::set_low_precision_tol(0.0);
+    if (world.rank() == 0) print("truncate size", full_size, low_size);
+    CHECK(double(low_size>=full_size),0.5,"test_low_precision truncate");
+    double err = (f-g).norm2();
+    CHECK(err,1e-9*fnorm,"test_low_precision truncate error");
+
+    if (world.rank() == 0) print("test_low_precision OK");
+    world.gop.fence();
+    if (ok) return 0;
+    return 1;
+}
+
 template <typename T, std::size_t NDIM>
 int test_apply_push_1d(World& world) {
     typedef Vector<double,NDIM> coordT;
@@ -1343,6 +1489,7 @@ int main(int argc, char**argv) {
         nfail+=test_plot<double,1>(world);
         nfail+=test_apply_push_1d<double,1>(world);
         nfail+=test_io<double,1>(world);
+        nfail+=test_io_async<double,1>(world);
 
         // stupid location for this test
         GenericConvolution1D<double,GaussianGenericFunctor<double> > gen(10,GaussianGenericFunctor<double>(100.0,100.0),0);
@@ -1363,6 +1510,8 @@ int main(int argc, char**argv) {
         nfail+=test_op<double_complex,1>(world);
         nfail+=test_plot<double_complex,1>(world);
         nfail+=test_io<double_complex,1>(world);
+        nfail+=test_io_async<double_complex,1>(world);
+        nfail+=test_low_precision<double_complex,1>(world);
 
         //TaskInterface::debug = true;
         nfail+=test_basic<double,2>(world);
@@ -1372,6 +1521,8 @@ int main(int argc, char**argv) {
         nfail+=test_op<double,2>(world);
         nfail+=test_plot<double,2>(world);
         nfail+=test_io<double,2>(world);
+        nfail+=test_io_async<double,2>(world);
+        nfail+=test_low_precision<double,2>(world);
 
         if (!smalltest) {
             nfail+=test_basic<double,3>(world);
@@ -1382,6 +1533,7 @@ int main(int argc, char**argv) {
             nfail+=test_coulomb(world);
             nfail+=test_plot<double,3>(world);
             nfail+=test_io<double,3>(world);
+            nfail+=test_io_async<double,3>(world);
             
             test_plot<double,4>(world); // slow unless reduce npt in test_plot // comment out to speed up travis
         }
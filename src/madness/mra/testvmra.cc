@@ -1,6 +1,7 @@
 #define NO_GENTENSOR
 #include <madness/mra/mra.h>
 #include <madness/mra/vmra.h>
+#include <madness/mra/sharedtree.h>
 #include <madness/misc/ran.h>
 
 const double PI = 3.1415926535897932384;
@@ -132,6 +133,99 @@ void test_add(World& world) {
 
 
 
+template <typename T, std::size_t NDIM>
+void test_compress(World& world) {
+    typedef Vector<double,NDIM> coordT;
+    typedef std::shared_ptr< FunctionFunctorInterface<T,NDIM> > functorT;
+
+    FunctionDefaults<NDIM>::set_cubic_cell(-10.0,10.0);
+    FunctionDefaults<NDIM>::set_k(6);
+    FunctionDefaults<NDIM>::set_thresh(1e-6);
+    FunctionDefaults<NDIM>::set_refine(true);
+    FunctionDefaults<NDIM>::set_initial_level(2);
+
+    // the vector versions transform the functions together, the
+    // copies are transformed one by one
+    const int nvec = 6;
+    std::vector< Function<T,NDIM> > f(nvec), g(nvec);
+    for (int i=0; i<nvec; ++i) {
+        functorT fn(RandomGaussian<T,NDIM>(FunctionDefaults<NDIM>::get_cell(),100.0));
+        f[i] = FunctionFactory<T,NDIM>(world).functor(fn);
+        g[i] = copy(f[i]);
+    }
+    f.push_back(f[0]);                    // must be handled only once
+    f.push_back(FunctionFactory<T,NDIM>(world).functor(
+            functorT(RandomGaussian<T,NDIM>(FunctionDefaults<NDIM>::get_cell(),100.0))).k(8));
+    g.push_back(g[0]);
+    g.push_back(copy(f.back()));
+
+    compress(world, f);
+    for (auto& gi : g) gi.compress();
+    double err_compress = 0.0;
+    for (std::size_t i=0; i<f.size(); ++i) MADNESS_CHECK(f[i].is_compressed());
+    for (std::size_t i=0; i<f.size(); ++i) {
+        err_compress = std::max(err_compress, (f[i]-g[i]).norm2());
+    }
+
+    reconstruct(world, f);
+    for (auto& gi : g) gi.reconstruct();
+    double err_reconstruct = 0.0;
+    for (std::size_t i=0; i<f.size(); ++i) MADNESS_CHECK(f[i].is_reconstructed());
+    for (std::size_t i=0; i<f.size(); ++i) {
+        err_reconstruct = std::max(err_reconstruct, (f[i]-g[i]).norm2());
+    }
+    print("errors in vector compress, reconstruct", err_compress, err_reconstruct);
+    MADNESS_CHECK(err_compress < 1e-12 && err_reconstruct < 1e-12);
+}
+
+
+template <typename T, std::size_t NDIM>
+void test_shared_tree(World& world) {
+    typedef std::shared_ptr< FunctionFunctorInterface<T,NDIM> > functorT;
+
+    FunctionDefaults<NDIM>::set_cubic_cell(-10.0,10.0);
+    FunctionDefaults<NDIM>::set_k(6);
+    FunctionDefaults<NDIM>::set_thresh(1e-5);
+    FunctionDefaults<NDIM>::set_refine(true);
+    FunctionDefaults<NDIM>::set_initial_level(2);
+
+    const int nvec = 5;
+    std::vector< Function<T,NDIM> > f(nvec+1);
+    for (auto& fi : f) {
+        functorT fn(RandomGaussian<T,NDIM>(FunctionDefaults<NDIM>::get_cell(),10.0));
+        fi = FunctionFactory<T,NDIM>(world).functor(fn);
+    }
+    refine_to_common_level(world, f);
+    Function<T,NDIM> a = f.back();
+    f.pop_back();
+
+    SharedTreeFunctions<T,NDIM> s(world, f);
+    std::vector< Function<T,NDIM> > g = s.to_functions();
+    double err_copy = 0.0;
+    for (int i=0; i<nvec; ++i) err_copy = std::max(err_copy, (f[i]-g[i]).norm2());
+    reconstruct(world, f);
+
+    Tensor<T> c(nvec,nvec-2);
+    c.fillrandom();
+    std::vector< Function<T,NDIM> > fc = transform(world, f, c);
+    g = transform(world, s, c).to_functions();
+    double err_transform = 0.0;
+    for (int i=0; i<nvec-2; ++i) err_transform = std::max(err_transform, (fc[i]-g[i]).norm2());
+    reconstruct(world, f);
+
+    const double err_inner = (matrix_inner(world, s, s) - matrix_inner(world, f, f)).normf();
+
+    // the shared-tree product is not refined, so it only agrees to about thresh
+    std::vector< Function<T,NDIM> > af = mul(world, a, f);
+    g = mul(world, a, s).to_functions();
+    double err_mul = 0.0;
+    for (int i=0; i<nvec; ++i) err_mul = std::max(err_mul, (af[i]-g[i]).norm2());
+
+    print("errors in shared tree copy, transform, inner, mul", err_copy, err_transform, err_inner, err_mul);
+    MADNESS_CHECK(err_copy < 1e-14 && err_transform < 1e-12 && err_inner < 1e-12 && err_mul < 1e-4);
+}
+
+
 template <typename T, typename R, int NDIM, bool sym>
 void test_inner(World& world) {
     typedef std::shared_ptr< FunctionFunctorInterface<T,NDIM> > ffunctorT;
@@ -397,6 +491,14 @@ void test_multi_to_multi_op(World& world) {
     double error=norm2(world,result);
     if (world.rank()==0) print("error in multi_to_multi ",error,norm_in,norm_out);
 
+    // pointwise op on batches of boxes, vin has been compressed above
+    reconstruct(world,vin);
+    refine_to_common_level(world,vin);
+    vecfuncT vout_batch=multi_to_multi_op_values(op, vin, true, 7);
+    double error_batch=norm2(world,sub(world,vout,vout_batch));
+    if (world.rank()==0) print("error in batched multi_to_multi ",error_batch);
+    MADNESS_CHECK(error_batch<thresh);
+
 }
 
 int main(int argc, char**argv) {
@@ -416,6 +518,11 @@ int main(int argc, char**argv) {
         test_add<double,3>(world);
         test_add<std::complex<double>,3 >(world);
 
+        test_compress<double,3>(world);
+        test_compress<std::complex<double>,2>(world);
+        test_shared_tree<double,3>(world);
+        test_shared_tree<std::complex<double>,2>(world);
+
         test_inner<double,double,1,false>(world);
         test_inner<double,double,1,true>(world);
         test_multi_to_multi_op<1>(world);
@@ -122,20 +122,51 @@
 #include <madness/mra/mra.h>
 #include <madness/mra/derivative.h>
 #include <madness/tensor/distributed_matrix.h>
+#include <algorithm>
 #include <cstdio>
 
 namespace madness {
 
 
 
+    namespace detail {
+
+        /// Returns the distinct functions of \c v in tree state \c state that can be transformed together
+
+        /// These are full-rank functions sharing the world, process map
+        /// and wavelet order of the first one found.  Returns an empty
+        /// vector if there are fewer than two.
+        template <typename T, std::size_t NDIM>
+        std::vector<FunctionImpl<T,NDIM>*> fusable_impls(const std::vector< Function<T,NDIM> >& v,
+                                                          const TreeState state) {
+            std::vector<FunctionImpl<T,NDIM>*> impls;
+            for (const auto& f : v) {
+                if (!f.is_initialized()) continue;
+                FunctionImpl<T,NDIM>* impl = f.get_impl().get();
+                if (impl->get_tree_state() != state || impl->get_tensor_type() != TT_FULL) continue;
+                if (!impls.empty() && (&impl->world != &impls[0]->world || impl->get_k() != impls[0]->get_k()
+                                       || impl->get_pmap() != impls[0]->get_pmap())) continue;
+                if (std::find(impls.begin(), impls.end(), impl) == impls.end()) impls.push_back(impl);
+            }
+            if (impls.size() < 2) impls.clear();
+            return impls;
+        }
+
+    } // namespace detail
+
     /// Compress a vector of functions
+
+    /// Functions that share their process map and wavelet order are
+    /// compressed in a single traversal (see FunctionImpl::compress_vector)
     template <typename T, std::size_t NDIM>
     void compress(World& world,
                   const std::vector< Function<T,NDIM> >& v,
                   bool fence=true) {
 
         PROFILE_BLOCK(Vcompress);
-        bool must_fence = false;
+        const auto impls = detail::fusable_impls(v, TreeState::reconstructed);
+        FunctionImpl<T,NDIM>::compress_vector(impls, false);
+        bool must_fence = !impls.empty();
         for (unsigned int i=0; i<v.size(); ++i) {
             if (!v[i].is_compressed()) {
                 v[i].compress(false);
@@ -148,12 +179,17 @@ namespace madness {
 
 
     /// Reconstruct a vector of functions
+
+    /// Compressed functions that share their process map and wavelet order
+    /// are reconstructed in a single traversal
     template <typename T, std::size_t NDIM>
     void reconstruct(World& world,
                      const std::vector< Function<T,NDIM> >& v,
                      bool fence=true) {
         PROFILE_BLOCK(Vreconstruct);
-        bool must_fence = false;
+        const auto impls = detail::fusable_impls(v, TreeState::compressed);
+        FunctionImpl<T,NDIM>::reconstruct_vector(impls, false);
+        bool must_fence = !impls.empty();
         for (unsigned int i=0; i<v.size(); ++i) {
             if (v[i].is_compressed() or v[i].is_nonstandard()) {
                 v[i].reconstruct(false);
@@ -277,13 +313,19 @@ namespace madness {
 
     /// reduces the tensor rank of the coefficient tensor (if applicable)
 
+    /// the nodes of all functions are reduced together, in batches of equal rank
     /// @return the vector for chaining
     template <typename T, std::size_t NDIM>
     std::vector< Function<T,NDIM> > reduce_rank(std::vector< Function<T,NDIM> > v,
                   double thresh=0.0, bool fence=true) {
     	if (v.size()==0) return v;
-    	for (auto& vv : v) vv.reduce_rank(thresh,false);
-    	if (fence) v[0].world().gop.fence();
+    	std::vector<std::pair<FunctionImpl<T,NDIM>*,double> > impls;
+    	for (auto& vv : v) {
+    		vv.verify();
+    		const double thresh1=(thresh==0.0) ? vv.get_impl()->get_tensor_args().thresh : thresh;
+    		impls.push_back(std::make_pair(vv.get_impl().get(),thresh1));
+    	}
+    	FunctionImpl<T,NDIM>::reduce_rank(impls,fence);
 		return v;
     }
 
@@ -1384,11 +1426,12 @@ namespace madness {
 
     /// @param[in]  op   the operator working on vin
     /// @param[in]  vin  vector of input Functions; needs to be refined to common level!
+    /// @param[in]  batchsize number of boxes passed to a pointwise op at once
     /// @return vector of output Functions vout = op(vin)
     template <typename T, typename opT, std::size_t NDIM>
     std::vector<Function<T,NDIM> > multi_to_multi_op_values(const opT& op,
             const std::vector< Function<T,NDIM> >& vin,
-            const bool fence=true) {
+            const bool fence=true, const std::size_t batchsize=1) {
         MADNESS_ASSERT(vin.size()>0);
         MADNESS_ASSERT(vin[0].is_initialized()); // might be changed
         World& world=vin[0].world();
@@ -1396,7 +1439,7 @@ namespace madness {
         dummy.set_impl(vin[0], false);
         std::vector<Function<T,NDIM> > vout=zero_functions<T,NDIM>(world, op.get_result_size());
         for (auto& out : vout) out.set_impl(vin[0],false);
-        dummy.multi_to_multi_op_values(op, vin, vout, fence);
+        dummy.multi_to_multi_op_values(op, vin, vout, fence, batchsize);
         return vout;
     }
 
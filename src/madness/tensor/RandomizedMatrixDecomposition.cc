@@ -77,6 +77,8 @@ Tensor<T> RandomizedMatrixDecomposition<T>::do_compute_range(const Y_former& Yfo
 		Q=Q0;
 
 		if (Q.dim(1)>maxrank) break;
+		// the range is the full space: what is left is rounding noise
+		if (Q.dim(1)>=Yformer.m()) break;
 		if (Q.dim(1)>Yformer.maxrank()) MADNESS_EXCEPTION("faulty QR step in randomized range finder",1);;
 
 	}
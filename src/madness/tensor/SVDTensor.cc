@@ -41,7 +41,7 @@ using namespace madness;
 
 namespace madness {
 
-static std::string reduction_alg="divide_conquer";
+static std::string reduction_alg="adaptive";
 
 template<typename T>
 void SVDTensor<T>::set_reduction_algorithm(const std::string alg) {
@@ -151,7 +151,7 @@ void SVDTensor<T>::recompute_from_range(const Tensor<T>& Q) {
 	// tensor = A = Q * Q(T) A = Q * Q(T) * left(T) * right
 	MADNESS_ASSERT(Q.dim(0)==this->flat_vector(0).dim(1));
 
-	const Tensor<T> U_ri=this->make_left_vector_with_weights();
+	const Tensor<T> U_ri=conj(this->make_left_vector_with_weights());
 	const Tensor<T> V_rj=this->flat_vector(1);
 
 	Tensor<T> B=inner(inner(conj(Q),U_ri,0,1),V_rj,1,0);
@@ -227,8 +227,12 @@ void SVDTensor<T>::orthonormalize_random(const double& eps) {
 
 	double wall0=wall_time();
 	RandomizedMatrixDecomposition<T> rmd=RMDFactory().maxrank(maxrank);
-	Tensor<T> scr=this->make_left_vector_with_weights();
+	Tensor<T> scr=conj(this->make_left_vector_with_weights());
 	Tensor<T> Q=rmd.compute_range(scr,this->flat_vector(1),eps*0.1);
+	if (Q.size()==0) {
+		*this=SVDTensor<T>(this->ndim(),this->dims());
+		return;
+	}
 
 	recompute_from_range(Q);
 	truncate_svd(eps);
@@ -241,7 +245,239 @@ void SVDTensor<T>::truncate_svd(const double& thresh) {
 
 	// compute the numerical rank
 	long maxrank=SRConf<T>::max_sigma(thresh, rank(), this->weights_);
-	*this=this->get_configs(0,maxrank);
+	if (maxrank<0 and rank()>0) *this=SVDTensor<T>(this->ndim(),this->dims());
+	else *this=this->get_configs(0,maxrank);
+}
+
+template<typename T>
+void SVDTensor<T>::orthonormalize_qr(const double& thresh) {
+	orthonormalize_qr_batched(std::vector<SVDTensor<T>*>(1,this),thresh);
+}
+
+template<typename T>
+void SVDTensor<T>::orthonormalize_qr_batched(const std::vector<SVDTensor<T>*>& batch,
+		const double& thresh) {
+	typedef typename Tensor<T>::scalar_type scalar_type;
+
+	std::vector<SVDTensor<T>*> work;
+	for (SVDTensor<T>* t : batch) {
+		if (t->has_no_data() or t->rank()==0) continue;
+		t->normalize();
+		if (t->rank()>1) work.push_back(t);
+	}
+	if (work.empty()) return;
+
+	// A(i,j) = U*(r,i) w(r) V(r,j) = Q0(a,i) L0(r,a) w(r) L1(r,b) Q1(b,j)
+	const std::size_t n=work.size();
+	std::vector<Tensor<T> > Q0(n), Q1(n), L0, L1;
+	for (std::size_t i=0; i<n; ++i) {
+		Q0[i]=conj(work[i]->flat_vector(0));
+		Q1[i]=copy(work[i]->flat_vector(1));
+	}
+	lq_batched(Q0,L0);
+	lq_batched(Q1,L1);
+
+	std::vector<Tensor<T> > M(n);
+	for (std::size_t i=0; i<n; ++i) {
+		for (long r=0; r<work[i]->rank(); ++r) L0[i](r,_)*=work[i]->weights_(r);
+		M[i]=inner(L0[i],L1[i],0,0);
+	}
+
+	std::vector<Tensor<T> > Up, VTp;
+	std::vector<Tensor<scalar_type> > s;
+	svd_batched(M,Up,s,VTp);
+
+	for (std::size_t i=0; i<n; ++i) {
+		SVDTensor<T>& t=*work[i];
+		const long imax=SRConf<T>::max_sigma(thresh,s[i].dim(0),s[i]);
+		if (imax<0) {
+			t=SVDTensor<T>(t.ndim(),t.dims());
+			continue;
+		}
+		Tensor<T> v0=conj(inner(Up[i](_,Slice(0,imax)),Q0[i],0,0));
+		Tensor<T> v1=inner(VTp[i](Slice(0,imax),_),Q1[i],1,0);
+		t.set_vectors_and_weights(copy(s[i](Slice(0,imax))),v0,v1);
+	}
+}
+
+template<typename T>
+void SVDTensor<T>::reduce_rank_batched(const std::vector<SVDTensor<T>*>& batch,
+		const double& thresh) {
+	const std::string alg=reduction_algorithm();
+	std::vector<SVDTensor<T>*> qr_batch;
+	for (SVDTensor<T>* t : batch) {
+		if (t->has_no_data() or t->rank()==0) continue;
+		const bool use_qr=(alg=="qr") or ((alg=="adaptive") and
+				(adaptive_algorithm(t->rank(),std::min(t->kVec(0),t->kVec(1)))=="qr"));
+		if (use_qr) qr_batch.push_back(t);
+		else t->reduce_rank(thresh);
+	}
+	orthonormalize_qr_batched(qr_batch,thresh);
+}
+
+
+namespace {
+
+	/// add a block of vectors to an orthonormal basis, using classical Gram-Schmidt twice
+
+	/// on exit block = coeff * [basis; new basis vectors]
+	/// @param[in]		basis	orthonormal basis vectors (m,k), may be empty
+	/// @param[in]		block	vectors to be added (b,k)
+	/// @param[in]		tol		singular value below which a residual direction is dropped
+	/// @param[out]		coeff	the coefficients of the block in the extended basis (b,m+b')
+	/// @return			the new basis vectors (b',k), orthonormal to basis
+	template<typename T>
+	Tensor<T> extend_basis(const Tensor<T>& basis, const Tensor<T>& block,
+			const double tol, Tensor<T>& coeff) {
+		typedef typename Tensor<T>::scalar_type scalar_type;
+
+		const long m=basis.size() ? basis.dim(0) : 0;
+		const long b=block.dim(0);
+
+		Tensor<T> residual=copy(block);
+		Tensor<T> proj;
+		if (m>0) {
+			proj=inner(block,conj(basis),1,1);
+			residual-=inner(proj,basis,1,0);
+			Tensor<T> proj2=inner(residual,conj(basis),1,1);
+			residual-=inner(proj2,basis,1,0);
+			proj+=proj2;
+		}
+
+		// orthonormalize the residual, dropping (numerically) linear dependent directions
+		Tensor<T> U,VT;
+		Tensor<scalar_type> s;
+		svd(residual,U,s,VT);
+		long nnew=0;
+		while (nnew<s.dim(0) and s(nnew)>tol) ++nnew;
+
+		coeff=Tensor<T>(b,m+nnew);
+		if (m>0) coeff(_,Slice(0,m-1))=proj;
+		if (nnew==0) return Tensor<T>();
+		for (long i=0; i<nnew; ++i) U(_,i)*=s(i);
+		coeff(_,Slice(m,m+nnew-1))=U(_,Slice(0,nnew-1));
+		return copy(VT(Slice(0,nnew-1),_));
+	}
+
+	/// return the norm of the singular values that are discarded when keeping s(0..i)
+	template<typename scalar_type>
+	double discarded(const Tensor<scalar_type>& s, const long i) {
+		double sum=0.0;
+		for (long j=i+1; j<s.dim(0); ++j) sum+=s(j)*s(j);
+		return std::sqrt(sum);
+	}
+
+	/// stack two sets of row vectors
+	template<typename T>
+	Tensor<T> stack_rows(const Tensor<T>& a, const Tensor<T>& b) {
+		if (a.size()==0) return b;
+		if (b.size()==0) return a;
+		Tensor<T> result(a.dim(0)+b.dim(0),a.dim(1));
+		result(Slice(0,a.dim(0)-1),_)=a;
+		result(Slice(a.dim(0),-1),_)=b;
+		return result;
+	}
+}
+
+template<typename T>
+void SVDTensor<T>::orthonormalize_blocked(const double& thresh, const long blocksize) {
+	typedef typename Tensor<T>::scalar_type scalar_type;
+
+	if (this->has_no_data() or rank()==0) return;
+	this->normalize();
+	if (rank()==1) return;
+
+	// the truncation error of each block adds up
+	const long nblock=(rank()+blocksize-1)/blocksize;
+	const double thresh_block=thresh/nblock;
+
+	// current result: basis0(a,i) s(a) basis1(a,j), with basis0 the complex conjugate
+	// of the left vectors
+	Tensor<T> basis0, basis1;
+	Tensor<scalar_type> s;
+	double error=0.0;	// accumulated truncation error
+
+	for (long start=0; start<rank(); start+=blocksize) {
+		const long end=std::min(start+blocksize,rank())-1;
+		const Tensor<scalar_type> w=this->weights_(Slice(start,end));
+
+		// directions whose contribution is below a tenth of the block threshold are dropped
+		const double wmax=w.absmax()*std::sqrt(double(end-start+1));
+		const double tol=std::max(1.e-12,0.1*thresh_block/std::max(wmax,1.e-300));
+
+		Tensor<T> c0,c1;
+		Tensor<T> new0=extend_basis(basis0,conj(this->flat_vector(0)(Slice(start,end),_)),tol,c0);
+		Tensor<T> new1=extend_basis(basis1,copy(this->flat_vector(1)(Slice(start,end),_)),tol,c1);
+
+		// the block is negligible
+		if (c0.dim(1)==0 or c1.dim(1)==0) continue;
+
+		// core in the extended bases
+		for (long r=0; r<c0.dim(0); ++r) c0(r,_)*=w(r);
+		Tensor<T> core=inner(c0,c1,0,0);
+		for (long a=0; a<s.size(); ++a) core(a,a)+=s(a);
+
+		Tensor<T> Up,VTp;
+		svd(core,Up,s,VTp);
+		const long i=SRConf<T>::max_sigma(thresh_block,s.dim(0),s);
+		error+=discarded(s,i);
+		if (i<0) {
+			basis0=Tensor<T>();
+			basis1=Tensor<T>();
+			s=Tensor<scalar_type>();
+			continue;
+		}
+		s=copy(s(Slice(0,i)));
+		basis0=inner(Up(_,Slice(0,i)),stack_rows(basis0,new0),0,0);
+		basis1=inner(VTp(Slice(0,i),_),stack_rows(basis1,new1),1,0);
+	}
+
+	// spend what is left of the error budget on a final truncation
+	const long i=(s.size()==0) ? -1 : SRConf<T>::max_sigma(thresh-error,s.dim(0),s);
+	if (i<0) {
+		*this=SVDTensor<T>(this->ndim(),this->dims());
+		return;
+	}
+	this->set_vectors_and_weights(copy(s(Slice(0,i))),conj(basis0(Slice(0,i),_)),
+			copy(basis1(Slice(0,i),_)));
+}
+
+template<typename T>
+std::string SVDTensor<T>::adaptive_algorithm(const long rank, const long k) {
+	// few terms compared to the dimension: the QR decompositions are cheap,
+	// and their cost does not depend on the final rank
+	if (rank<=std::max(k/5,long(64))) return "qr";
+	// many terms: the randomized range finder terminates at the final rank
+	return "rmd";
+}
+
+template<typename T>
+void SVDTensor<T>::adaptive_reduce(const double& thresh) {
+	if (this->has_no_data() or rank()==0) return;
+	const std::string alg=adaptive_algorithm(rank(),std::min(this->kVec(0),this->kVec(1)));
+	if (alg=="qr") orthonormalize_qr(thresh);
+	else orthonormalize_random(thresh);
+}
+
+template<typename T>
+void SVDTensor<T>::reduce_rank(const double& thresh) {
+	const std::string alg=reduction_algorithm();
+	if (alg=="divide_conquer") {
+		divide_and_conquer_reduce(thresh);
+	} else if (alg=="adaptive") {
+		adaptive_reduce(thresh);
+	} else if (alg=="full") {
+		if (this->has_no_data() or rank()==0) return;
+		*this=SVDTensor<T>(this->reconstruct(),thresh);
+	} else if (alg=="rmd") {
+		orthonormalize_random(thresh);
+	} else if (alg=="qr") {
+		orthonormalize_qr(thresh);
+	} else if (alg=="blocked") {
+		orthonormalize_blocked(thresh);
+	} else {
+		MADNESS_EXCEPTION("unknown reduction algorithm in SVDTensor.cc",1);
+	}
 }
 
 
@@ -152,6 +152,43 @@ public:
 
 	void truncate_svd(const double& thresh);
 
+	/// reduce the rank using QR decompositions of both factors and an SVD of the (r,r) core
+
+	/// operation count is O(kr^2 + r^3); more accurate than ortho3, which
+	/// diagonalizes the overlap matrices and thereby squares their condition
+	void orthonormalize_qr(const double& thresh);
+
+	/// reduce the rank using blocked Gram-Schmidt
+
+	/// the terms are added block by block to orthonormal bases for the left
+	/// and right vectors, and the core is recompressed after each block;
+	/// operation count is O(krm + r/b (m+b)^3) for final rank m and block size b
+	void orthonormalize_blocked(const double& thresh, const long blocksize=64);
+
+	/// reduce the rank with the algorithm best suited to the rank and the vector dimensions
+	void adaptive_reduce(const double& thresh);
+
+	/// return the algorithm adaptive_reduce uses for a given rank and vector dimension
+
+	/// @param[in]	rank	the rank of the representation to be reduced
+	/// @param[in]	k		the smaller of the two vector dimensions (k^3 in 6D)
+	/// @return		"qr" or "rmd"; blocked Gram-Schmidt was slower than either in
+	///				test_gentensor's benchmark, it is only used when requested by name
+	static std::string adaptive_algorithm(const long rank, const long k);
+
+	/// reduce the rank with the algorithm given by reduction_algorithm()
+	void reduce_rank(const double& thresh);
+
+	/// reduce the rank of many SVDTensors, see reduce_rank
+
+	/// the tensors that are reduced by QR are processed together, with
+	/// batched LAPACK calls; sort the batch by rank and vector dimension
+	/// to let neighboring calls work on matrices of the same shape
+	static void reduce_rank_batched(const std::vector<SVDTensor<T>*>& batch, const double& thresh);
+
+	/// orthonormalize_qr for many SVDTensors, with batched LAPACK calls
+	static void orthonormalize_qr_batched(const std::vector<SVDTensor<T>*>& batch, const double& thresh);
+
 	static std::string reduction_algorithm();
 	static void set_reduction_algorithm(const std::string alg);
 
@@ -176,24 +213,9 @@ public:
     		const SVDTensor<R>& t1, const SVDTensor<Q>& t2);
 
     friend SVDTensor<T> reduce(std::list<SVDTensor<T> >& addends, double eps) {
-    	SVDTensor<T>& ref=addends.front();
-    	if (ref.reduction_algorithm()=="divide_conquer") {
-        	SVDTensor<T> result=SVDTensor<T>::concatenate(addends);
-        	result.divide_and_conquer_reduce(eps);
-        	return result;
-    	} else if (ref.reduction_algorithm()=="full") {
-    		SVDTensor<T> tmp=SVDTensor<T>::concatenate(addends);
-    		Tensor<T> full=tmp.reconstruct();
-    		return SVDTensor<T>(full,eps);
-    	} else if (ref.reduction_algorithm()=="rmd") {
-    		SVDTensor<T> result=SVDTensor<T>::concatenate(addends);
-    		result.orthonormalize_random(eps);
-    		return result;
-    	} else {
-    		MADNESS_EXCEPTION("unknown reduction algorithm in SVDTensor.h",1);
-    		return SVDTensor<T>();
-    	}
-
+    	SVDTensor<T> result=SVDTensor<T>::concatenate(addends);
+    	result.reduce_rank(eps);
+    	return result;
     }
 
     friend SVDTensor<T> copy(const SVDTensor<T>& rhs) {
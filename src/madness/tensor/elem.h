@@ -509,13 +509,20 @@ namespace madness {
 #else
 
 #include <madness/tensor/tensor_lapack.h>
+#include <madness/tensor/systolic_eigensolver.h>
 
 namespace madness {
-    // sequential fall back code
+    // sequential fall back code, large real problems are distributed
     template <typename T>
     void sygvp(World& world,
                const Tensor<T>& a, const Tensor<T>& B, int itype,
                Tensor<T>& V, Tensor< typename Tensor<T>::scalar_type >& e) {
+        if constexpr (std::is_same<T,double>::value) {
+            if (itype==1 and use_systolic_eigensolver(world,a.dim(0))) {
+                sygv_systolic(world, a, B, V, e);
+                return;
+            }
+        }
         sygv(a, B, itype, V, e);
 	world.gop.broadcast_serializable(V,0);
 	world.gop.broadcast_serializable(e,0);
@@ -509,6 +509,42 @@ namespace madness {
         TENSOR_ASSERT(info == 0, "svd: Lapack failed", info, &a);
     }
 
+    /** \brief   Compute the singular value decompositions of a batch of matrices
+
+    See svd; the workspace is allocated once, for the largest matrix.
+    */
+    template <typename T>
+    void svd_batched(const std::vector< Tensor<T> >& a, std::vector< Tensor<T> >& U,
+             std::vector< Tensor< typename Tensor<T>::scalar_type > >& s, std::vector< Tensor<T> >& VT) {
+        const std::size_t nbatch=a.size();
+        U.resize(nbatch);
+        s.resize(nbatch);
+        VT.resize(nbatch);
+
+        integer lwork=1;
+        for (const Tensor<T>& ai : a) {
+            TENSOR_ASSERT(ai.ndim() == 2, "svd requires matrix",ai.ndim(),&ai);
+            const integer m = ai.dim(0), n = ai.dim(1);
+            lwork=max<integer>(lwork,max<integer>(3*min(m,n)+max(m,n),5*min(m,n)-4)*32);
+        }
+        Tensor<T> work(std::vector<long>(1,lwork),false);
+
+        for (std::size_t i=0; i<nbatch; ++i) {
+            integer m = a[i].dim(0), n = a[i].dim(1), rmax = min<integer>(m,n);
+            integer info;
+            Tensor<T> A(copy(a[i]));
+
+            s[i] = Tensor< typename Tensor<T>::scalar_type >(rmax);
+            U[i] = Tensor<T>(m,rmax);
+            VT[i] = Tensor<T>(rmax,n);
+            dgesvd_("S","S", &n, &m, A.ptr(), &n, s[i].ptr(),
+                    VT[i].ptr(), &n, U[i].ptr(), &rmax, work.ptr(), &lwork,
+                    &info, (char_len) 1, (char_len) 1);
+            mask_info(info);
+            TENSOR_ASSERT(info == 0, "svd: Lapack failed", info, &a[i]);
+        }
+    }
+
     /// same as svd, but it optimizes away the tensor construction: a = U * diag(s) * VT
 
     /// note that S and VT are swapped in the calling list for c/fortran consistency!
@@ -929,6 +965,29 @@ namespace madness {
     	lq_result(A,R,tau,work,false);
     }
 
+    /// compute the LQ decompositions of a batch of matrices, see lq
+
+    /// the workspace is allocated once, for the largest matrix
+    template<typename T>
+    void lq_batched(std::vector< Tensor<T> >& A, std::vector< Tensor<T> >& L) {
+        L.resize(A.size());
+
+        integer lwork=1, ntau=1;
+        for (const Tensor<T>& a : A) {
+            TENSOR_ASSERT(a.ndim() == 2, "lq requires a matrix",a.ndim(),&a);
+            const integer n=a.dim(1);
+            lwork=std::max<integer>(lwork,2*n+(n+1)*64);
+            ntau=std::max<integer>(ntau,std::min<integer>(a.dim(0),n));
+        }
+        Tensor<T> tau(std::vector<long>(1,ntau),false);
+        Tensor<T> work(std::vector<long>(1,lwork),false);
+
+        for (std::size_t i=0; i<A.size(); ++i) {
+            L[i]=Tensor<T>(A[i].dim(0),std::min(A[i].dim(0),A[i].dim(1)));
+            lq_result(A[i],L[i],tau,work,false);
+        }
+    }
+
     /// compute the LQ decomposition of the matrix A = L Q
 
     /// @param[in,out]	A	on entry the (n,m) matrix to be decomposed
@@ -1392,6 +1451,34 @@ namespace madness {
     template
     void lq(Tensor<double>& A, Tensor<double>& L);
 
+    template
+    void lq_batched(std::vector<Tensor<float> >& A, std::vector<Tensor<float> >& L);
+
+    template
+    void lq_batched(std::vector<Tensor<double> >& A, std::vector<Tensor<double> >& L);
+
+    template
+    void lq_batched(std::vector<Tensor<float_complex> >& A, std::vector<Tensor<float_complex> >& L);
+
+    template
+    void lq_batched(std::vector<Tensor<double_complex> >& A, std::vector<Tensor<double_complex> >& L);
+
+    template
+    void svd_batched(const std::vector<Tensor<float> >& a, std::vector<Tensor<float> >& U,
+             std::vector<Tensor<Tensor<float>::scalar_type> >& s, std::vector<Tensor<float> >& VT);
+
+    template
+    void svd_batched(const std::vector<Tensor<double> >& a, std::vector<Tensor<double> >& U,
+             std::vector<Tensor<Tensor<double>::scalar_type> >& s, std::vector<Tensor<double> >& VT);
+
+    template
+    void svd_batched(const std::vector<Tensor<float_complex> >& a, std::vector<Tensor<float_complex> >& U,
+             std::vector<Tensor<Tensor<float_complex>::scalar_type> >& s, std::vector<Tensor<float_complex> >& VT);
+
+    template
+    void svd_batched(const std::vector<Tensor<double_complex> >& a, std::vector<Tensor<double_complex> >& U,
+             std::vector<Tensor<Tensor<double_complex>::scalar_type> >& s, std::vector<Tensor<double_complex> >& VT);
+
     template
     void lq_result(Tensor<double>& A, Tensor<double>& R, Tensor<double>& tau, Tensor<double>& work,
     		bool do_qr);
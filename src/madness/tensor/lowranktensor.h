@@ -646,7 +646,7 @@ public:
 	}
 
     void reduce_rank(const double& thresh) {
-		if (is_svd_tensor()) get_svdtensor().divide_and_conquer_reduce(thresh*facReduce());
+		if (is_svd_tensor()) get_svdtensor().reduce_rank(thresh*facReduce());
 		if (is_tensortrain()) get_tensortrain().truncate(thresh*facReduce());
     }
 
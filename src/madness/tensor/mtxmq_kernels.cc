@@ -0,0 +1,240 @@
+/*
+  This file is part of MADNESS.
+
+  Copyright (C) 2007,2010 Oak Ridge National Laboratory
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+
+  For more information please contact:
+
+  Robert J. Harrison
+  Oak Ridge National Laboratory
+  One Bethel Valley Road
+  P.O. Box 2008, MS-6367
+
+  email: harrisonrj@ornl.gov
+  tel:   865-241-3937
+  fax:   865-572-0680
+
+  $Id$
+*/
+
+/// \file tensor/mtxmq_kernels.cc
+/// \brief Fixed-size mTxmq kernels for the shapes used by the operator apply
+
+// The transformations in SeparatedConvolution::apply_transformation are
+// c(i,j) = sum(k) a(k,i)*b(k,j) with a long i loop and a small square
+// b (dimj==dimk==k or 2k).  For these sizes the overhead of a BLAS call
+// dominates.  Here the j and k loops have compile-time extent so the
+// compiler can keep a block of rows of c in registers and fully unroll
+// and vectorize the j loop.  The same source is compiled for the
+// default, AVX2 and AVX-512 instruction sets and the best supported
+// version is selected at runtime with CPUID.
+
+#include <madness/madness_config.h>
+#include <madness/tensor/mxm.h>
+
+#include <complex>
+#include <cstdlib>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(__INTEL_COMPILER)
+#define MADNESS_MTXMQ_X86_DISPATCH
+#endif
+
+namespace madness {
+
+    namespace {
+
+        typedef std::complex<double> double_complex;
+
+        // Access to the real and imaginary parts of an element; the
+        // imaginary part of a real element is a compile-time zero so the
+        // complex arithmetic below reduces to the real case
+        template <typename T> struct parts;
+
+        template <> struct parts<double> {
+            static const bool is_complex = false;
+            static double re(const double* p, long i) { return p[i]; }
+            static double im(const double*, long) { return 0.0; }
+            static void set(double* p, long i, double re, double) { p[i] = re; }
+        };
+
+        template <> struct parts<double_complex> {
+            static const bool is_complex = true;
+            static double re(const double_complex* p, long i) {
+                return reinterpret_cast<const double*>(p)[2*i];
+            }
+            static double im(const double_complex* p, long i) {
+                return reinterpret_cast<const double*>(p)[2*i+1];
+            }
+            static void set(double_complex* p, long i, double re, double im) {
+                double* q = reinterpret_cast<double*>(p);
+                q[2*i] = re;
+                q[2*i+1] = im;
+            }
+        };
+
+        // Rows i0..i0+R-1 of c
+        template <long K, long R, typename cT, typename aT, typename bT>
+        inline __attribute__((always_inline))
+        void mtxmq_rows(long i0, long dimi, cT* MADNESS_RESTRICT c,
+                        const aT* MADNESS_RESTRICT a, const bT* MADNESS_RESTRICT b, long ldb) {
+            double cr[R][K], ci[R][K];
+            for (long r=0; r<R; ++r) {
+                for (long j=0; j<K; ++j) cr[r][j] = ci[r][j] = 0.0;
+            }
+            for (long k=0; k<K; ++k) {
+                double ar[R], ai[R];
+                for (long r=0; r<R; ++r) {
+                    ar[r] = parts<aT>::re(a, k*dimi+i0+r);
+                    ai[r] = parts<aT>::im(a, k*dimi+i0+r);
+                }
+                for (long j=0; j<K; ++j) {
+                    const double br = parts<bT>::re(b, k*ldb+j);
+                    const double bi = parts<bT>::im(b, k*ldb+j);
+                    for (long r=0; r<R; ++r) {
+                        cr[r][j] += ar[r]*br - ai[r]*bi;
+                        ci[r][j] += ar[r]*bi + ai[r]*br;
+                    }
+                }
+            }
+            for (long r=0; r<R; ++r) {
+                for (long j=0; j<K; ++j) parts<cT>::set(c, (i0+r)*K+j, cr[r][j], ci[r][j]);
+            }
+        }
+
+        template <long K, typename cT, typename aT, typename bT>
+        inline __attribute__((always_inline))
+        void mtxmq_fixed(long dimi, cT* MADNESS_RESTRICT c,
+                         const aT* MADNESS_RESTRICT a, const bT* MADNESS_RESTRICT b, long ldb) {
+            // Fewer rows per pass for complex results to stay within the registers
+            const long R = parts<cT>::is_complex ? 2 : 4;
+            long i = 0;
+            for (; i+R<=dimi; i+=R) mtxmq_rows<K,R>(i, dimi, c, a, b, ldb);
+            for (; i<dimi; ++i) mtxmq_rows<K,1>(i, dimi, c, a, b, ldb);
+        }
+
+#define MADNESS_MTXMQ_SWITCH                                            \
+        switch (k) {                                                    \
+        case  4: mtxmq_fixed< 4>(dimi, c, a, b, ldb); return true;      \
+        case  5: mtxmq_fixed< 5>(dimi, c, a, b, ldb); return true;      \
+        case  6: mtxmq_fixed< 6>(dimi, c, a, b, ldb); return true;      \
+        case  7: mtxmq_fixed< 7>(dimi, c, a, b, ldb); return true;      \
+        case  8: mtxmq_fixed< 8>(dimi, c, a, b, ldb); return true;      \
+        case  9: mtxmq_fixed< 9>(dimi, c, a, b, ldb); return true;      \
+        case 10: mtxmq_fixed<10>(dimi, c, a, b, ldb); return true;      \
+        case 11: mtxmq_fixed<11>(dimi, c, a, b, ldb); return true;      \
+        case 12: mtxmq_fixed<12>(dimi, c, a, b, ldb); return true;      \
+        case 13: mtxmq_fixed<13>(dimi, c, a, b, ldb); return true;      \
+        case 14: mtxmq_fixed<14>(dimi, c, a, b, ldb); return true;      \
+        case 15: mtxmq_fixed<15>(dimi, c, a, b, ldb); return true;      \
+        case 16: mtxmq_fixed<16>(dimi, c, a, b, ldb); return true;      \
+        case 17: mtxmq_fixed<17>(dimi, c, a, b, ldb); return true;      \
+        case 18: mtxmq_fixed<18>(dimi, c, a, b, ldb); return true;      \
+        case 19: mtxmq_fixed<19>(dimi, c, a, b, ldb); return true;      \
+        case 20: mtxmq_fixed<20>(dimi, c, a, b, ldb); return true;      \
+        default: return false;                                          \
+        }
+
+        template <typename cT, typename aT, typename bT>
+        bool mtxmq_generic(long dimi, long k, cT* c, const aT* a, const bT* b, long ldb) {
+            MADNESS_MTXMQ_SWITCH
+        }
+
+#ifdef MADNESS_MTXMQ_X86_DISPATCH
+        template <typename cT, typename aT, typename bT>
+        __attribute__((target("avx2,fma")))
+        bool mtxmq_avx2(long dimi, long k, cT* c, const aT* a, const bT* b, long ldb) {
+            MADNESS_MTXMQ_SWITCH
+        }
+
+        template <typename cT, typename aT, typename bT>
+        __attribute__((target("avx512f,avx2,fma")))
+        bool mtxmq_avx512(long dimi, long k, cT* c, const aT* a, const bT* b, long ldb) {
+            MADNESS_MTXMQ_SWITCH
+        }
+#endif
+
+#undef MADNESS_MTXMQ_SWITCH
+
+        enum mtxmq_isa_kind {MTXMQ_DISABLED, MTXMQ_GENERIC, MTXMQ_AVX2, MTXMQ_AVX512};
+
+        mtxmq_isa_kind detect_isa() {
+            const char* env = std::getenv("MAD_MTXMQ_KERNELS");
+            if (env && (std::strcmp(env,"0")==0 || std::strcmp(env,"no")==0)) return MTXMQ_DISABLED;
+#ifdef MADNESS_MTXMQ_X86_DISPATCH
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f")) return MTXMQ_AVX512;
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return MTXMQ_AVX2;
+#endif
+            return MTXMQ_GENERIC;
+        }
+
+        mtxmq_isa_kind mtxmq_isa() {
+            static const mtxmq_isa_kind isa = detect_isa();
+            return isa;
+        }
+
+        template <typename cT, typename aT, typename bT>
+        bool mtxmq_dispatch(long dimi, long dimj, long dimk,
+                            cT* c, const aT* a, const bT* b, long ldb) {
+            if (dimj != dimk) return false;
+            if (ldb == -1) ldb = dimj;
+            switch (mtxmq_isa()) {
+#ifdef MADNESS_MTXMQ_X86_DISPATCH
+            case MTXMQ_AVX512: return mtxmq_avx512(dimi, dimk, c, a, b, ldb);
+            case MTXMQ_AVX2:   return mtxmq_avx2(dimi, dimk, c, a, b, ldb);
+#endif
+            case MTXMQ_GENERIC: return mtxmq_generic(dimi, dimk, c, a, b, ldb);
+            default: return false;
+            }
+        }
+
+    }  // namespace
+
+    bool mTxmq_kernel(long dimi, long dimj, long dimk,
+                      double* MADNESS_RESTRICT c, const double* a, const double* b, long ldb) {
+        return mtxmq_dispatch(dimi, dimj, dimk, c, a, b, ldb);
+    }
+
+    bool mTxmq_kernel(long dimi, long dimj, long dimk,
+                      std::complex<double>* MADNESS_RESTRICT c,
+                      const std::complex<double>* a, const std::complex<double>* b, long ldb) {
+        return mtxmq_dispatch(dimi, dimj, dimk, c, a, b, ldb);
+    }
+
+    bool mTxmq_kernel(long dimi, long dimj, long dimk,
+                      std::complex<double>* MADNESS_RESTRICT c,
+                      const std::complex<double>* a, const double* b, long ldb) {
+        return mtxmq_dispatch(dimi, dimj, dimk, c, a, b, ldb);
+    }
+
+    bool mTxmq_kernel(long dimi, long dimj, long dimk,
+                      std::complex<double>* MADNESS_RESTRICT c,
+                      const double* a, const std::complex<double>* b, long ldb) {
+        return mtxmq_dispatch(dimi, dimj, dimk, c, a, b, ldb);
+    }
+
+    const char* mTxmq_kernel_isa() {
+        switch (mtxmq_isa()) {
+        case MTXMQ_AVX512: return "avx512";
+        case MTXMQ_AVX2:   return "avx2";
+        case MTXMQ_GENERIC: return "generic";
+        default: return "disabled";
+        }
+    }
+
+}  // namespace madness
@@ -36,6 +36,7 @@
 #define MADNESS_TENSOR_MXM_H__INCLUDED
 
 #include <madness/madness_config.h>
+#include <complex>
 
 #define HAVE_FAST_BLAS
 #ifdef  HAVE_FAST_BLAS
@@ -181,6 +182,37 @@ namespace madness {
     }
     
 
+    /// \name Fixed-size mTxmq kernels (see mtxmq_kernels.cc)
+
+    /// Computes \c c(i,j)=sum(k)a(k,i)*b(k,j) for the square \c b with
+    /// \c dimj==dimk in [4,20] that dominate the operator apply.  The kernel
+    /// for the instruction set of the host (default, AVX2 or AVX-512) is
+    /// selected at runtime; setting \c MAD_MTXMQ_KERNELS=0 disables them.
+    /// Return false without touching \c c if no kernel handles the shape.
+    ///@{
+    bool mTxmq_kernel(long dimi, long dimj, long dimk,
+                      double* MADNESS_RESTRICT c, const double* a, const double* b, long ldb);
+    bool mTxmq_kernel(long dimi, long dimj, long dimk,
+                      std::complex<double>* MADNESS_RESTRICT c,
+                      const std::complex<double>* a, const std::complex<double>* b, long ldb);
+    bool mTxmq_kernel(long dimi, long dimj, long dimk,
+                      std::complex<double>* MADNESS_RESTRICT c,
+                      const std::complex<double>* a, const double* b, long ldb);
+    bool mTxmq_kernel(long dimi, long dimj, long dimk,
+                      std::complex<double>* MADNESS_RESTRICT c,
+                      const double* a, const std::complex<double>* b, long ldb);
+
+    /// No kernels for other types
+    template <typename aT, typename bT, typename cT>
+    inline bool mTxmq_kernel(long dimi, long dimj, long dimk,
+                             cT* MADNESS_RESTRICT c, const aT* a, const bT* b, long ldb) {
+        return false;
+    }
+
+    /// Name of the instruction set of the selected kernels ("avx512", "avx2", "generic" or "disabled")
+    const char* mTxmq_kernel_isa();
+    ///@}
+
 #if defined(HAVE_FAST_BLAS) && !defined(HAVE_INTEL_MKL)
     // MKL provides support for mixed real/complex operations but most other libraries do not
     
@@ -254,6 +286,7 @@ namespace madness {
         if (ldb == -1) ldb=dimj;
         MADNESS_ASSERT(ldb>=dimj);
 
+        if (mTxmq_kernel(dimi, dimj, dimk, c, a, b, ldb)) return;
         if (dimi==0 || dimj==0) return; // nothing to do and *GEMM will complain
         if (dimk==0) {
             for (long i=0; i<dimi*dimj; i++) c[i] = 0.0;
@@ -336,6 +369,7 @@ namespace madness {
         if (ldb == -1) ldb=dimj;
         MADNESS_ASSERT(ldb>=dimj);
 
+        if (mTxmq_kernel(dimi, dimj, dimk, c, a, b, ldb)) return;
         if (dimi==0 || dimj==0) return; // nothing to do and *GEMM will complain
         if (dimk==0) {
             for (long i=0; i<dimi*dimj; i++) c[i] = 0.0;
@@ -382,6 +416,7 @@ namespace madness {
     template <typename aT, typename bT, typename cT>
     void mTxmq(long dimi, long dimj, long dimk,
                cT* MADNESS_RESTRICT c, const aT* a, const bT* b, long ldb=-1) {
+        if (mTxmq_kernel(dimi, dimj, dimk, c, a, b, ldb)) return;
         mTxmq_reference(dimi, dimj, dimk, c, a, b, ldb);
     }
 
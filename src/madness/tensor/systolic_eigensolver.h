@@ -0,0 +1,251 @@
+#ifndef MADNESS_SYSTOLIC_EIGENSOLVER_H
+#define MADNESS_SYSTOLIC_EIGENSOLVER_H
+
+/*
+  This file is part of MADNESS.
+
+  Copyright (C) 2007,2010 Oak Ridge National Laboratory
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+
+  For more information please contact:
+
+  Robert J. Harrison
+  Oak Ridge National Laboratory
+  One Bethel Valley Road
+  P.O. Box 2008, MS-6367
+
+  email: harrisonrj@ornl.gov
+  tel:   865-241-3937
+  fax:   865-572-0680
+*/
+
+/// \file systolic_eigensolver.h
+/// \brief Distributed eigensolver for real symmetric matrices using the systolic loop
+
+#include <madness/world/MADworld.h>
+#include <madness/tensor/tensor.h>
+#include <madness/tensor/tensor_lapack.h>
+#include <madness/tensor/distributed_matrix.h>
+#include <madness/tensor/systolic.h>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace madness {
+
+    /// One-sided Jacobi eigensolver for a real symmetric matrix A
+
+    /// Row \c i of the column distributed matrix \c AV holds \f$ w_i = A v_i \f$
+    /// followed by the vector \f$ v_i \f$, initially the i-th row of A and the
+    /// i-th unit vector.  A Jacobi rotation of the pair (i,j) only touches
+    /// rows i and j, so all pairs are generated by the systolic loop without
+    /// any other communication.  On convergence the \f$ v_i \f$ are the
+    /// eigenvectors and \f$ v_i \cdot w_i \f$ the eigenvalues.
+    ///
+    /// Pairs are rotated if their off-diagonal element exceeds the current
+    /// threshold times the largest element of A; the threshold is lowered
+    /// after each sweep until it reaches \c thresh.
+    template <typename T>
+    class SystolicEigensolver : public SystolicMatrixAlgorithm<T> {
+        const int64_t n;        ///< dimension of A
+        const T scale;          ///< largest absolute element of A
+        const T thresh;         ///< final relative threshold for rotations
+        T tol;                  ///< relative threshold of the current sweep
+        int iter;               ///< sweep counter
+        const int maxiter;      ///< maximum number of sweeps
+        AtomicInt nrot;         ///< number of rotations in the current sweep
+
+        static T dot(const T* MADNESS_RESTRICT a, const T* MADNESS_RESTRICT b, const int64_t n) {
+            T s=0;
+            for (int64_t k=0; k<n; ++k) s+=a[k]*b[k];
+            return s;
+        }
+
+    public:
+        /// @param[in,out] AV (n,2n) column distributed matrix [A | 1], see class description
+        /// @param[in] scale the largest absolute element of A
+        /// @param[in] thresh relative threshold for the off-diagonal elements
+        /// @param[in] tag the MPI tag used for communication
+        /// @param[in] nthread the number of local threads
+        SystolicEigensolver(DistributedMatrix<T>& AV, const T scale, const T thresh, int tag,
+                int nthread=ThreadPool::size()+1)
+            : SystolicMatrixAlgorithm<T>(AV, tag, nthread)
+            , n(AV.coldim())
+            , scale(scale)
+            , thresh(thresh)
+            , tol(std::max(T(0.1),thresh))
+            , iter(-1)
+            , maxiter(50)
+        {
+            MADNESS_ASSERT(AV.is_column_distributed());
+            MADNESS_ASSERT(AV.rowdim() == 2*n);
+            nrot=0;
+        }
+
+        void start_iteration_hook(const TaskThreadEnv& env) {
+            if (env.id() == 0) {
+                iter++;
+                if (iter > 0) tol = std::max(T(0.01)*tol, thresh);
+                nrot = 0;
+            }
+        }
+
+        void end_iteration_hook(const TaskThreadEnv& env) {
+            if (env.id() == 0) {
+                int nr = nrot;
+                SystolicMatrixAlgorithm<T>::get_world().gop.sum(nr);
+                nrot = nr;
+            }
+        }
+
+        bool converged(const TaskThreadEnv& env) const {
+            if (iter+1 >= maxiter) {
+                if (env.id()==0 and SystolicMatrixAlgorithm<T>::get_rank()==0)
+                    print("SystolicEigensolver: not converged after",maxiter,"sweeps");
+                return true;
+            }
+            return (nrot == 0 && tol == thresh);
+        }
+
+        void kernel(int i, int j, T * MADNESS_RESTRICT rowi, T * MADNESS_RESTRICT rowj) {
+            T * MADNESS_RESTRICT wi = rowi;
+            T * MADNESS_RESTRICT wj = rowj;
+            T * MADNESS_RESTRICT vi = rowi + n;
+            T * MADNESS_RESTRICT vj = rowj + n;
+
+            const T aij = dot(vi, wj, n);
+            if (std::abs(aij) <= tol*scale) return;
+            const T aii = dot(vi, wi, n);
+            const T ajj = dot(vj, wj, n);
+            nrot++;
+
+            // rotation annihilating aij
+            const T theta = (ajj - aii)/(2*aij);
+            const T t = ((theta < 0) ? -1 : 1)/(std::abs(theta) + std::sqrt(theta*theta + 1));
+            const T c = 1/std::sqrt(t*t + 1);
+            const T s = t*c;
+
+            for (int64_t k=0; k<n; ++k) {
+                const T x = wi[k], y = wj[k];
+                wi[k] = c*x - s*y;
+                wj[k] = s*x + c*y;
+            }
+            for (int64_t k=0; k<n; ++k) {
+                const T x = vi[k], y = vj[k];
+                vi[k] = c*x - s*y;
+                vj[k] = s*x + c*y;
+            }
+        }
+    };
+
+
+    /// Smallest matrix dimension for which sygvp uses the distributed eigensolver
+
+    /// Jacobi needs several times the operations of LAPACK, so the
+    /// distributed solver pays off only if the work is shared by enough
+    /// processes.  Set to a negative value to always use LAPACK.
+    inline int64_t& systolic_eigensolver_min_dimension() {
+        static int64_t nmin=1000;
+        return nmin;
+    }
+
+    /// Minimum number of processes for which sygvp uses the distributed eigensolver
+    inline int& systolic_eigensolver_min_processes() {
+        static int pmin=8;
+        return pmin;
+    }
+
+    /// Returns true if sygvp should solve a problem of dimension n with the distributed eigensolver
+    inline bool use_systolic_eigensolver(World& world, const int64_t n) {
+        const int64_t nmin=systolic_eigensolver_min_dimension();
+        return (nmin>=0) and (n>=nmin) and (world.size()>=systolic_eigensolver_min_processes());
+    }
+
+
+    /// Generalized real symmetric eigenproblem A x = lambda B x using the distributed eigensolver
+
+    /// Same interface and result as \c sygv with \c itype=1 (eigenvalues in
+    /// ascending order, eigenvectors normalized as \f$ V^T B V = 1 \f$), but
+    /// the result is replicated on all processes of the world.  B is
+    /// reduced by a replicated Cholesky factorization \f$ B = U^T U \f$;
+    /// the transformation to \f$ U^{-T} A U^{-1} \f$ and back, and the
+    /// diagonalization itself are distributed over the rows.
+    /// This is a collective call.
+    /// @param[in] world the world
+    /// @param[in] A the symmetric matrix
+    /// @param[in] B the positive definite metric
+    /// @param[out] V the eigenvectors in the columns
+    /// @param[out] e the eigenvalues
+    /// @param[in] thresh relative convergence threshold for the off-diagonal elements
+    template <typename T>
+    void sygv_systolic(World& world, const Tensor<T>& A, const Tensor<T>& B,
+                       Tensor<T>& V, Tensor<T>& e, const T thresh=1.e-13) {
+        const int64_t n=A.dim(0);
+        MADNESS_CHECK(A.ndim()==2 and A.dim(1)==n and B.dim(0)==n and B.dim(1)==n);
+
+        Tensor<T> U=copy(B);
+        cholesky(U);
+        const Tensor<T> Uinv=inverse(U);
+
+        DistributedMatrix<T> AV=column_distributed_matrix<T>(world, n, 2*n);
+        int64_t ilo, ihi;
+        AV.local_colrange(ilo, ihi);
+        const int64_t nlocal=ihi-ilo+1;
+
+        // local rows of U^-T A U^-1 and of the unit matrix
+        if (nlocal>0) {
+            const Tensor<T> Ui=copy(Uinv(_,Slice(ilo,ihi)));
+            AV.data()(_,Slice(0,n-1))=inner(inner(Ui,A,0,0),Uinv);
+            for (int64_t i=0; i<nlocal; ++i) AV.data()(i,n+ilo+i)=1.0;
+        }
+        T scale=(nlocal>0) ? AV.data()(_,Slice(0,n-1)).absmax() : T(0);
+        world.gop.max(scale);
+
+        if (scale>0) {
+            // the threads synchronize after each step of the loop, so use only
+            // as many as have enough work
+            const int nthread=std::max<int64_t>(1,std::min<int64_t>(ThreadPool::size()+1,nlocal*n/65536));
+            world.taskq.add(new SystolicEigensolver<T>(AV, scale, thresh,
+                    world.mpi.comm().unique_tag(), nthread));
+            world.taskq.fence();
+        }
+
+        // eigenvalues and back-transformed eigenvectors of the local rows
+        Tensor<T> evals(n), Vt(n,n);
+        if (nlocal>0) {
+            const Tensor<T> W=AV.data()(_,Slice(0,n-1));
+            const Tensor<T> Y=AV.data()(_,Slice(n,2*n-1));
+            for (int64_t i=0; i<nlocal; ++i) evals(ilo+i)=W(i,_).trace(Y(i,_));
+            Vt(Slice(ilo,ihi),_)=inner(Y,Uinv,1,1);
+        }
+        world.gop.sum(evals.ptr(), n);
+        world.gop.sum(Vt.ptr(), Vt.size());
+
+        std::vector<int64_t> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(),
+                [&evals](int64_t i, int64_t j) {return evals(i)<evals(j);});
+
+        V=Tensor<T>(n,n);
+        e=Tensor<T>(n);
+        for (int64_t k=0; k<n; ++k) {
+            e(k)=evals(order[k]);
+            V(_,k)=Vt(order[k],_);
+        }
+    }
+}
+
+#endif
@@ -35,6 +35,8 @@
 #include <madness/madness_config.h>
 #include <madness/misc/ran.h>
 #include <madness/world/posixmem.h>
+#include <madness/world/numa.h>
+#include <madness/world/worldmem.h>
 
 #include <memory>
 #include <complex>
@@ -355,6 +357,10 @@ namespace madness {
 
 #ifdef TENSOR_USE_SHARED_ALIGNED_ARRAY
                     _p = _shptr.allocate(_size, TENSOR_ALIGNMENT);
+#elif defined TENSOR_USE_POOL_ALLOCATOR
+                    // Pool blocks are 64-byte aligned
+                    _p = static_cast<T*>(pool_allocate(sizeof(T)*_size));
+                    _shptr.reset(_p, PoolDeleter<T>(sizeof(T)*_size), PoolAllocator<T>());
 #elif defined WORLD_GATHER_MEM_STATS
                     _p = new T[_size];
                     _shptr = std::shared_ptr<T>(_p);
@@ -362,6 +368,9 @@ namespace madness {
                     if (posix_memalign((void **) &_p, TENSOR_ALIGNMENT, sizeof(T)*_size)) throw 1;
                     _shptr.reset(_p, &free);
 #endif
+                    // Keep large blocks on the allocating thread's node
+                    if (numa::enabled() && sizeof(T)*_size >= numa::min_bind_bytes)
+                        numa::bind_memory_local(_p, sizeof(T)*_size);
                 }
                 catch (...) {
 		  // Ideally use if constexpr here but want headers C++14 for cuda compatibility
@@ -60,6 +60,16 @@ namespace madness {
     void svd_result(Tensor<T>& a, Tensor<T>& U,
              Tensor< typename Tensor<T>::scalar_type >& s, Tensor<T>& VT, Tensor<T>& work);
 
+    /// Computes the singular value decompositions of a batch of matrices
+
+    /// Same as calling svd for each matrix, but the workspace is allocated
+    /// once for the whole batch; meant for many small matrices, e.g. one
+    /// from each node of a function.
+    /// \ingroup linalg
+    template <typename T>
+    void svd_batched(const std::vector< Tensor<T> >& a, std::vector< Tensor<T> >& U,
+             std::vector< Tensor< typename Tensor<T>::scalar_type > >& s, std::vector< Tensor<T> >& VT);
+
     /// Solves linear equations
     
     /// \ingroup linalg
@@ -148,6 +158,10 @@ namespace madness {
     /// LQ decomposition
     template<typename T>
     void lq(Tensor<T>& A, Tensor<T>& L);
+
+    /// LQ decompositions of a batch of matrices, see svd_batched
+    template<typename T>
+    void lq_batched(std::vector< Tensor<T> >& A, std::vector< Tensor<T> >& L);
     /// LQ decomposition
     template<typename T>
     void lq_result(Tensor<T>& A, Tensor<T>& R, Tensor<T>& tau, Tensor<T>& work,bool do_qr);
@@ -3,6 +3,8 @@
 #include <madness/madness_config.h>
 #include <madness/world/MADworld.h>
 #include <madness/tensor/distributed_matrix.h>
+#include <madness/tensor/systolic_eigensolver.h>
+#include <madness/world/timers.h>
 
 using namespace madness;
 
@@ -33,6 +35,59 @@ void check(DistributedMatrix<double>& A) {
     }
 }
 
+/// random symmetric A and positive definite B, identical on all processes
+void make_problem(World& world, const int64_t n, Tensor<double>& A, Tensor<double>& B) {
+    A=Tensor<double>(n,n);
+    B=Tensor<double>(n,n);
+    if (world.rank()==0) {
+        A.fillrandom();
+        A=A+transpose(A);
+        Tensor<double> M(n,n);
+        M.fillrandom();
+        B=inner(M,M,1,1)*(1.0/n);
+        for (int64_t i=0; i<n; ++i) B(i,i)+=1.0;
+    }
+    world.gop.broadcast(A.ptr(), A.size(), 0);
+    world.gop.broadcast(B.ptr(), B.size(), 0);
+}
+
+/// compare the distributed generalized eigensolver with LAPACK
+void check_eigensolver(World& world, const int64_t n) {
+    Tensor<double> A, B, V, e, V0, e0;
+    make_problem(world, n, A, B);
+    sygv_systolic(world, A, B, V, e);
+    sygv(A, B, 1, V0, e0);
+
+    const double scale=e0.absmax();
+    MADNESS_CHECK((e-e0).absmax() < 1.e-10*scale);
+    Tensor<double> S=inner(V,inner(B,V),0,0);
+    for (int64_t i=0; i<n; ++i) S(i,i)-=1.0;
+    MADNESS_CHECK(S.absmax() < 1.e-10);
+    Tensor<double> F=inner(V,inner(A,V),0,0);
+    for (int64_t i=0; i<n; ++i) F(i,i)-=e(i);
+    MADNESS_CHECK(F.absmax() < 1.e-10*scale);
+}
+
+/// time the distributed generalized eigensolver against replicated LAPACK
+void benchmark_eigensolver(World& world, const int64_t n) {
+    Tensor<double> A, B, V, e;
+    make_problem(world, n, A, B);
+
+    world.gop.fence();
+    double wall=wall_time();
+    sygv(A, B, 1, V, e);
+    world.gop.fence();
+    const double t_lapack=wall_time()-wall;
+
+    wall=wall_time();
+    sygv_systolic(world, A, B, V, e);
+    world.gop.fence();
+    const double t_systolic=wall_time()-wall;
+
+    if (world.rank()==0) printf("sygv  n=%6ld  nproc=%4d  lapack %8.3fs  systolic %8.3fs\n",
+            long(n), world.size(), t_lapack, t_systolic);
+}
+
 int main(int argc, char** argv) {
     initialize(argc, argv);
     World world(SafeMPI::COMM_WORLD);
@@ -48,6 +103,12 @@ int main(int argc, char** argv) {
         check(A);
     }
 
+    for (int64_t neig : {1, 2, 7, 64, 101}) check_eigensolver(world, neig);
+
+    // pass the largest dimension for the benchmark as argument
+    const int64_t nmax = (argc>1) ? std::atol(argv[1]) : 200;
+    for (int64_t neig=100; neig<=nmax; neig*=2) benchmark_eigensolver(world, neig);
+
     world.gop.fence();
     finalize();
     return 0;
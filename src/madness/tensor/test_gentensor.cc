@@ -34,7 +34,9 @@
 
 #include <madness/tensor/tensor.h>
 #include <madness/tensor/gentensor.h>
+#include <madness/tensor/SVDTensor.h>
 #include <madness/world/print.h>
+#include <madness/world/timers.h>
 #include "gentensor.h"
 
 #if defined USE_GENTENSOR && MADNESS_HAS_GOOGLE_TEST
@@ -600,6 +602,109 @@ namespace {
 
 
 
+    /// make a sum of addends of the given rank, spanned by a common basis with decaying weights
+
+    /// mimics the addition of pair functions in MP2/CC2: the total rank is naddend*rank,
+    /// the numerical rank is determined by nbasis and decay
+    template<typename T>
+    SVDTensor<T> make_svd_sum(const long k, const long nbasis, const long naddend,
+    		const long rank, const double decay) {
+    	const long k3=k*k*k;
+    	std::vector<long> dim(6,k);
+    	Tensor<T> basis0(k3,nbasis), basis1(k3,nbasis), R;
+    	basis0.fillrandom();
+    	basis1.fillrandom();
+    	qr(basis0,R);
+    	qr(basis1,R);
+
+    	std::list<SVDTensor<T> > addends;
+    	for (long a=0; a<naddend; ++a) {
+    		Tensor<T> c0(rank,nbasis), c1(rank,nbasis);
+    		c0.fillrandom();
+    		c1.fillrandom();
+    		for (long j=0; j<nbasis; ++j) {
+    			c0(_,j)*=exp(-decay*j);
+    			c1(_,j)*=exp(-decay*j);
+    		}
+    		Tensor<typename Tensor<T>::scalar_type> w(rank);
+    		w.fillrandom();
+    		SVDTensor<T> addend(6,dim.data());
+    		addend.set_vectors_and_weights(w,inner(c0,basis0,1,1),inner(c1,basis1,1,1));
+    		addends.push_back(addend);
+    	}
+    	return SVDTensor<T>::concatenate(addends);
+    }
+
+    /// test the rank reduction algorithms of SVDTensor
+    TYPED_TEST(LowRankTensorTest, SVDReduction) {
+    	const double thresh=1.e-4;
+    	const std::string save=SVDTensor<TypeParam>::reduction_algorithm();
+    	for (long naddend : {1, 5, 40}) {
+    		const SVDTensor<TypeParam> sum=make_svd_sum<TypeParam>(4,30,naddend,4,0.2);
+    		const Tensor<TypeParam> ref=sum.reconstruct();
+    		// divide_conquer is not included: it exceeds the threshold for many addends
+    		for (std::string alg : {"qr", "blocked", "rmd", "adaptive"}) {
+    			SVDTensor<TypeParam>::set_reduction_algorithm(alg);
+    			SVDTensor<TypeParam> s=copy(sum);
+    			s.reduce_rank(thresh);
+    			ASSERT_LE(s.rank(),std::min(sum.rank(),64l));
+    			ASSERT_LT((s.reconstruct()-ref).normf(),thresh);
+    		}
+    	}
+    	SVDTensor<TypeParam>::set_reduction_algorithm(save);
+    }
+
+    /// test that the batched rank reduction agrees with the node-by-node reduction
+    TYPED_TEST(LowRankTensorTest, SVDReductionBatched) {
+    	const double thresh=1.e-4;
+    	std::vector<SVDTensor<TypeParam> > single, batched;
+    	std::vector<SVDTensor<TypeParam>*> batch;
+    	for (long naddend : {1, 5, 5, 40}) {
+    		single.push_back(make_svd_sum<TypeParam>(4,30,naddend,4,0.2));
+    		batched.push_back(copy(single.back()));
+    	}
+    	for (auto& s : batched) batch.push_back(&s);
+    	SVDTensor<TypeParam>::reduce_rank_batched(batch,thresh);
+    	for (std::size_t i=0; i<single.size(); ++i) {
+    		single[i].reduce_rank(thresh);
+    		ASSERT_EQ(batched[i].rank(),single[i].rank());
+    		ASSERT_LT((batched[i].reconstruct()-single[i].reconstruct()).normf(),0.01*thresh);
+    	}
+    }
+
+    /// time the rank reduction algorithms for rank distributions as they occur in MP2/CC2
+    TEST(SVDReductionBenchmark, PairFunctionRanks) {
+    	const double thresh=1.e-5;
+    	const long k=10;
+    	const std::string save=SVDTensor<double>::reduction_algorithm();
+
+    	// naddend, rank per addend, numerical rank (nbasis), decay
+    	struct Case {long naddend, rank, nbasis; double decay;};
+    	for (const Case& c : {Case{4,4,40,0.15}, Case{25,4,60,0.15}, Case{50,4,300,0.03},
+    			Case{100,4,80,0.15}, Case{100,10,120,0.15}}) {
+    		const SVDTensor<double> sum=make_svd_sum<double>(k,c.nbasis,c.naddend,c.rank,c.decay);
+    		const Tensor<double> ref=sum.reconstruct();
+    		print("rank reduction of",c.naddend,"addends, input rank",sum.rank(),", k^3 =",k*k*k);
+    		for (std::string alg : {"divide_conquer", "qr", "blocked", "rmd", "adaptive"}) {
+    			SVDTensor<double>::set_reduction_algorithm(alg);
+    			SVDTensor<double> s;
+    			const double wall0=wall_time();
+    			long nrep=0;
+    			do {
+    				s=copy(sum);
+    				s.reduce_rank(thresh);
+    				++nrep;
+    			} while (wall_time()-wall0<0.2);
+    			const double wall=(wall_time()-wall0)/nrep;
+    			const double error=(s.reconstruct()-ref).normf();
+    			printf("  %-15s  %10.5fs  rank %4ld  error %8.2e\n",alg.c_str(),wall,s.rank(),error);
+    			if (alg!="divide_conquer") ASSERT_LT(error,thresh);	// see SVDReduction
+    		}
+    	}
+    	SVDTensor<double>::set_reduction_algorithm(save);
+    }
+
+
     /// test slices of LowRankTensors
     TYPED_TEST(LowRankTensorTest, SlicingConstruction) {
         for (int ndim=2; ndim<=TENSOR_MAXDIM; ndim+=2) {	// even number of dimensions only
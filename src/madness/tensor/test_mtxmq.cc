@@ -165,6 +165,54 @@ void trantimer(const char* s, long ni, long nj, long nk, double *a, double *b, d
   printf("%20s %3ld %3ld %3ld %8.2f %8.2f\n",s, ni,nj,nk, fastest, fastest_dgemm);
 }
 
+// Check the fixed-size kernels for the complex and mixed real/complex
+// cases against the reference implementation
+template <typename cT, typename aT, typename bT>
+void test_kernel(const char* s, long nimax) {
+    Tensor<aT> a(20*nimax);
+    Tensor<bT> b(20*20);
+    Tensor<cT> c(nimax*20), d(nimax*20);
+    a.fillrandom();
+    b.fillrandom();
+    for (long m=4; m<=20; ++m) {
+        for (long ni=1; ni<=nimax; ni+=7) {
+            mTxmq(ni,m,m,c.ptr(),a.ptr(),b.ptr());
+            mTxmq_reference(ni,m,m,d.ptr(),a.ptr(),b.ptr());
+            for (long i=0; i<ni*m; ++i) {
+                double err = std::abs(c[i]-d[i]);
+                if (err > 1e-12) {
+                    printf("test_mtxmq: %s kernel error %ld %ld %e\n",s,ni,m,err);
+                    exit(1);
+                }
+            }
+        }
+    }
+}
+
+// Time the (m*m,m)T*(m,m) shape of the operator apply (dispatched to the
+// fixed-size kernels for m=4..20) against calling BLAS directly
+void kerneltimer(long m, double *a, double *b, double *c) {
+    long ni = m*m;
+    double nflop = 2.0*ni*m*m;
+    double fastest=0.0, fastest_dgemm=0.0;
+    for (int t=0; t<100; t++) {
+        double start = SafeMPI::Wtime();
+        for (long loop=0; loop<100; ++loop) mTxmq(ni,m,m,c,a,b);
+        start = SafeMPI::Wtime() - start;
+        fastest = std::max(fastest, 1.e-9*nflop/(start/100.0));
+    }
+    for (int t=0; t<100; t++) {
+        double start = SafeMPI::Wtime();
+        for (long loop=0; loop<100; ++loop) {
+            double zero=0.0, one=1.0;
+            cblas::gemm(cblas::NoTrans,cblas::Trans,m,ni,m,one,b,m,a,ni,zero,c,m);
+        }
+        start = SafeMPI::Wtime() - start;
+        fastest_dgemm = std::max(fastest_dgemm, 1.e-9*nflop/(start/100.0));
+    }
+    printf("%20s %3ld %3ld %3ld %8.2f %8.2f\n","kernel(m*m,m)T*(m,m)", ni,m,m, fastest, fastest_dgemm);
+}
+
 int main(int argc, char * argv[]) {
 
     if (getenv("MAD_SMALL_TESTS")) smalltest=true;
@@ -225,12 +273,20 @@ int main(int argc, char * argv[]) {
     }
     printf("... OK!\n");
 
+    printf("Testing complex and mixed kernels (%s) ... \n", mTxmq_kernel_isa());
+    test_kernel<double_complex,double_complex,double_complex>("complex*complex",std::min(64L,nimax));
+    test_kernel<double_complex,double_complex,double>("complex*real",std::min(64L,nimax));
+    test_kernel<double_complex,double,double_complex>("real*complex",std::min(64L,nimax));
+    printf("... OK!\n");
+
     if (!smalltest) {
         printf("%20s %3s %3s %3s %8s %8s (GF/s)\n", "type", "M", "N", "K", "LOOP", "BLAS");
         for (ni=2; ni<60; ni+=2) timer("(m*m)T*(m*m)", ni,ni,ni,a,b,c);
         for (m=2; m<=30; m+=2) timer("(m*m,m)T*(m*m)", m*m,m,m,a,b,c);
         for (m=2; m<=30; m+=2) trantimer("tran(m,m,m)", m*m,m,m,a,b,c);
         for (m=2; m<=20; m+=2) timer("(20*20,20)T*(20,m)", 20*20,m,20,a,b,c);
+        printf("\nfixed-size kernels: %s\n", mTxmq_kernel_isa());
+        for (m=4; m<=20; m+=1) kerneltimer(m,a,b,c);
     }
 
     SafeMPI::Finalize();
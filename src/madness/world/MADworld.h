@@ -45,6 +45,7 @@
 #include <madness/world/world_task_queue.h>
 #include <madness/world/worldgop.h>
 #include <madness/world/worlddc.h>
+#include <madness/world/world_epoch.h>
 
 
 #endif // MADNESS_WORLD_MADWORLD_H__INCLUDED
@@ -43,6 +43,7 @@
 #define MADNESS_DQ_STATS
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <iostream>
 #include <madness/config.h>
@@ -50,9 +51,10 @@
 #include <madness/world/worldmutex.h>
 #include <stdint.h>
 #include <utility>
+#include <vector>
 
 /// \file dqueue.h
-/// \brief Implements DQueue
+/// \brief Implements DQueue and WSDeque
 
 namespace madness {
 
@@ -62,9 +64,12 @@ namespace madness {
         uint64_t npop_front;    ///< #calls to pop_front
         uint64_t ngrow;         ///< #calls to grow
         uint64_t nmax;          ///< Lifetime max. entries in the queue
+        uint64_t nsteal;        ///< #tasks stolen from another thread's deque
+        uint64_t nsteal_miss;   ///< #steal attempts that found nothing
 
         DQStats()
-                : npush_back(0), npush_front(0), npop_front(0), ngrow(0), nmax(0) {}
+                : npush_back(0), npush_front(0), npop_front(0), ngrow(0), nmax(0)
+                , nsteal(0), nsteal_miss(0) {}
     };
 
 
@@ -329,6 +334,153 @@ namespace madness {
         }
     };
 
+
+    /// A Chase-Lev work-stealing deque.
+
+    /// The owning thread pushes and pops at the bottom (LIFO) without
+    /// taking a lock; any other thread may steal from the top (FIFO)
+    /// with a single compare-and-swap.  The circular buffer grows as
+    /// needed.  Since a thief may still be reading an old buffer, retired
+    /// buffers are only freed on destruction.
+    ///
+    /// Statistics are only ever written by the owner, so they include
+    /// the steals made \em by the owner from other deques via
+    /// \c steal_from().  \c T must be trivially copyable (i.e., a pointer).
+    template <typename T>
+    class WSDeque {
+        struct Array {
+            const int64_t size;          ///< Capacity, always a power of two
+            std::atomic<T>* const buf;   ///< The circular buffer
+
+            Array(int64_t size) : size(size), buf(new std::atomic<T>[size]) {}
+
+            ~Array() { delete [] buf; }
+
+            T get(int64_t i) const {
+                return buf[i & (size-1)].load(std::memory_order_relaxed);
+            }
+
+            void put(int64_t i, T value) {
+                buf[i & (size-1)].store(value, std::memory_order_relaxed);
+            }
+
+            Array* grow(int64_t b, int64_t t) const {
+                Array* a = new Array(2*size);
+                for (int64_t i=t; i<b; ++i) a->put(i, get(i));
+                return a;
+            }
+        };
+
+        alignas(64) std::atomic<int64_t> top;    ///< Next index to steal (thieves)
+        alignas(64) std::atomic<int64_t> bottom; ///< Next index to push (owner)
+        std::atomic<Array*> array;               ///< Current buffer
+        std::vector<Array*> retired;             ///< Old buffers (owner only)
+        DQStats stats;                           ///< Statistics (owner only)
+
+        WSDeque(const WSDeque&) = delete;
+        WSDeque& operator=(const WSDeque&) = delete;
+
+    public:
+        WSDeque(int64_t hint=1024) : top(0), bottom(0) {
+            int64_t sz = 2;
+            while (sz < hint) sz *= 2;
+            array.store(new Array(sz), std::memory_order_relaxed);
+        }
+
+        ~WSDeque() {
+            delete array.load(std::memory_order_relaxed);
+            for (Array* a : retired) delete a;
+        }
+
+        /// Push value onto the bottom of the deque (owner only)
+        void push(T value) {
+            const int64_t b = bottom.load(std::memory_order_relaxed);
+            const int64_t t = top.load(std::memory_order_acquire);
+            Array* a = array.load(std::memory_order_relaxed);
+            if (b - t > a->size - 1) {
+                retired.push_back(a);
+                a = a->grow(b, t);
+                array.store(a, std::memory_order_release);
+#ifdef MADNESS_DQ_STATS
+                ++(stats.ngrow);
+#endif
+            }
+            a->put(b, value);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom.store(b+1, std::memory_order_relaxed);
+#ifdef MADNESS_DQ_STATS
+            ++(stats.npush_back);
+            if (uint64_t(b+1-t) > stats.nmax) stats.nmax = b+1-t;
+#endif
+        }
+
+        /// Pop value off the bottom of the deque (owner only) ... returns false if empty
+        bool pop(T& value) {
+            const int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+            Array* a = array.load(std::memory_order_relaxed);
+            bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t t = top.load(std::memory_order_relaxed);
+            bool got = false;
+            if (t <= b) {
+                value = a->get(b);
+                got = true;
+                if (t == b) {
+                    // Last element ... race against the thieves for it
+                    got = top.compare_exchange_strong(t, t+1,
+                                                      std::memory_order_seq_cst,
+                                                      std::memory_order_relaxed);
+                    bottom.store(b+1, std::memory_order_relaxed);
+                }
+            }
+            else {
+                bottom.store(b+1, std::memory_order_relaxed);
+            }
+#ifdef MADNESS_DQ_STATS
+            if (got) ++(stats.npop_front);
+#endif
+            return got;
+        }
+
+        /// Steal value off the top of the deque (any thread) ... returns false if empty or lost a race
+        bool steal(T& value) {
+            int64_t t = top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t b = bottom.load(std::memory_order_acquire);
+            if (t < b) {
+                Array* a = array.load(std::memory_order_acquire);
+                T x = a->get(t);
+                if (top.compare_exchange_strong(t, t+1,
+                                                std::memory_order_seq_cst,
+                                                std::memory_order_relaxed)) {
+                    value = x;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /// Steal from \c victim, recording the outcome in this deque's statistics (owner only)
+        bool steal_from(WSDeque& victim, T& value) {
+            const bool got = victim.steal(value);
+#ifdef MADNESS_DQ_STATS
+            if (got) ++(stats.nsteal);
+            else ++(stats.nsteal_miss);
+#endif
+            return got;
+        }
+
+        /// Approximate number of entries (exact only if quiescent)
+        size_t size() const {
+            const int64_t n = bottom.load(std::memory_order_relaxed) - top.load(std::memory_order_relaxed);
+            return n > 0 ? size_t(n) : 0;
+        }
+
+        const DQStats& get_stats() const {
+            return stats;
+        }
+    };
+
 #if defined(MADNESS_DQ_USE_PREBUF) && !defined(MADNESS_CXX_COMPILER_IS_ICC)
     template <typename T> thread_local T DQueue<T>::prebuf[DQueue<T>::NPREBUF] = {T{}};
     template <typename T> thread_local T DQueue<T>::prebufhi[DQueue<T>::NPREBUF] = {T{}};
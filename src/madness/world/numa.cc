@@ -0,0 +1,191 @@
+/*
+  This file is part of MADNESS.
+
+  Copyright (C) 2007,2010 Oak Ridge National Laboratory
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+
+  For more information please contact:
+
+  Robert J. Harrison
+  Oak Ridge National Laboratory
+  One Bethel Valley Road
+  P.O. Box 2008, MS-6367
+
+  email: harrisonrj@ornl.gov
+  tel:   865-241-3937
+  fax:   865-572-0680
+*/
+
+/**
+ \file numa.cc
+ \brief Implements NUMA topology queries and node-local memory placement.
+ \ingroup threads
+*/
+
+#include <madness/world/numa.h>
+#include <madness/world/madness_exception.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/mempolicy.h>
+#define MADNESS_NUMA_LINUX
+#endif
+
+namespace madness {
+    namespace numa {
+
+        namespace detail {
+            bool enabled = false;
+        }
+
+        namespace {
+            bool initialized = false;
+            std::vector< std::vector<int> > cpus_of_node; ///< cpus_of_node[node] = list of cpus
+            std::vector<int> node_of_cpu;                ///< node_of_cpu[cpu] = node or -1
+
+            // Parse a cpulist such as "0-3,8-11" appending the cpus to cpus
+            void parse_cpulist(const std::string& s, std::vector<int>& cpus) {
+                std::stringstream ss(s);
+                std::string range;
+                while (std::getline(ss, range, ',')) {
+                    int lo, hi;
+                    const int n = sscanf(range.c_str(), "%d-%d", &lo, &hi);
+                    if (n == 1) hi = lo;
+                    if (n < 1) continue;
+                    for (int cpu=lo; cpu<=hi; ++cpu) cpus.push_back(cpu);
+                }
+            }
+
+            void read_topology() {
+#ifdef MADNESS_NUMA_LINUX
+                const char* sysdir = "/sys/devices/system/node";
+                DIR* dir = opendir(sysdir);
+                if (dir) {
+                    std::vector< std::pair<int, std::vector<int> > > nodes;
+                    while (dirent* entry = readdir(dir)) {
+                        int node;
+                        if (strncmp(entry->d_name, "node", 4) != 0) continue;
+                        if (sscanf(entry->d_name+4, "%d", &node) != 1) continue;
+                        std::ifstream f(std::string(sysdir) + "/" + entry->d_name + "/cpulist");
+                        std::string line;
+                        std::vector<int> cpus;
+                        if (f && std::getline(f, line)) parse_cpulist(line, cpus);
+                        if (!cpus.empty()) nodes.push_back(std::make_pair(node, cpus));
+                    }
+                    closedir(dir);
+
+                    // Nodes are indexed by their kernel number
+                    int maxnode = -1;
+                    for (const auto& n : nodes) maxnode = std::max(maxnode, n.first);
+                    cpus_of_node.resize(maxnode+1);
+                    for (const auto& n : nodes) cpus_of_node[n.first] = n.second;
+                }
+#endif
+                if (cpus_of_node.empty()) {
+                    long ncpu = 1;
+#ifdef MADNESS_NUMA_LINUX
+                    ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+                    if (ncpu < 1) ncpu = 1;
+#endif
+                    cpus_of_node.resize(1);
+                    for (int cpu=0; cpu<ncpu; ++cpu) cpus_of_node[0].push_back(cpu);
+                }
+
+                for (std::size_t node=0; node<cpus_of_node.size(); ++node) {
+                    for (int cpu : cpus_of_node[node]) {
+                        if (cpu >= int(node_of_cpu.size())) node_of_cpu.resize(cpu+1, -1);
+                        node_of_cpu[cpu] = node;
+                    }
+                }
+            }
+        }
+
+        void initialize() {
+            if (initialized) return;
+            initialized = true;
+            read_topology();
+
+            const char* cnuma = getenv("MAD_NUMA");
+            if (cnuma) {
+                int value = 0;
+                if (sscanf(cnuma, "%d", &value) != 1)
+                    MADNESS_EXCEPTION("MAD_NUMA is not an integer", 0);
+                detail::enabled = (value != 0);
+            }
+        }
+
+        int num_nodes() {
+            return cpus_of_node.empty() ? 1 : int(cpus_of_node.size());
+        }
+
+        const std::vector<int>& node_cpus(int node) {
+            MADNESS_ASSERT(node >= 0 && node < int(cpus_of_node.size()));
+            return cpus_of_node[node];
+        }
+
+        int current_node() {
+#ifdef MADNESS_NUMA_LINUX
+            const int cpu = sched_getcpu();
+            if (cpu >= 0 && cpu < int(node_of_cpu.size())) return node_of_cpu[cpu];
+#endif
+            return -1;
+        }
+
+        void bind_thread_to_node(int node) {
+#ifdef MADNESS_NUMA_LINUX
+            const std::vector<int>& cpus = node_cpus(node);
+            if (cpus.empty()) return;
+            cpu_set_t mask;
+            CPU_ZERO(&mask);
+            for (int cpu : cpus) CPU_SET(cpu, &mask);
+            if (sched_setaffinity(0, sizeof(mask), &mask) == -1) {
+                perror("system error message");
+                std::fprintf(stderr, "numa::bind_thread_to_node: could not set cpu affinity\n");
+            }
+#endif
+        }
+
+        void bind_memory_local(void* p, std::size_t nbyte) {
+#if defined(MADNESS_NUMA_LINUX) && defined(SYS_mbind)
+            const int node = current_node();
+            if (node < 0) return;
+
+            static const std::size_t pagesize = sysconf(_SC_PAGESIZE);
+            const std::size_t lo = (reinterpret_cast<std::size_t>(p) + pagesize - 1) & ~(pagesize - 1);
+            const std::size_t hi = (reinterpret_cast<std::size_t>(p) + nbyte) & ~(pagesize - 1);
+            if (hi <= lo) return;
+
+            const std::size_t bits = 8*sizeof(unsigned long);
+            unsigned long mask[16] = {0};
+            if (std::size_t(node) >= 16*bits) return;
+            mask[node/bits] = 1ul << (node%bits);
+            syscall(SYS_mbind, lo, hi - lo, MPOL_PREFERRED, mask, 16*bits, 0);
+#endif
+        }
+
+    } // namespace numa
+} // namespace madness
@@ -0,0 +1,100 @@
+/*
+  This file is part of MADNESS.
+
+  Copyright (C) 2007,2010 Oak Ridge National Laboratory
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+
+  For more information please contact:
+
+  Robert J. Harrison
+  Oak Ridge National Laboratory
+  One Bethel Valley Road
+  P.O. Box 2008, MS-6367
+
+  email: harrisonrj@ornl.gov
+  tel:   865-241-3937
+  fax:   865-572-0680
+*/
+
+#ifndef MADNESS_WORLD_NUMA_H__INCLUDED
+#define MADNESS_WORLD_NUMA_H__INCLUDED
+
+/**
+ \file numa.h
+ \brief NUMA topology queries and node-local memory placement.
+ \ingroup threads
+
+ NUMA mode is opt-in via the environment variable \c MAD_NUMA.  The
+ topology is read from \c /sys/devices/system/node on Linux; elsewhere
+ (or if nothing can be read) the machine is treated as a single node and
+ all calls are harmless no-ops.
+*/
+
+#include <cstddef>
+#include <vector>
+
+namespace madness {
+    namespace numa {
+
+        namespace detail {
+            extern bool enabled; ///< True if NUMA mode was requested and initialized
+        }
+
+        /// Read the topology and the \c MAD_NUMA environment variable.
+
+        /// Called by \c ThreadPool::begin before the pool threads start;
+        /// repeated calls do nothing.
+        void initialize();
+
+        /// Returns true if NUMA mode is enabled.
+        inline bool enabled() {
+            return detail::enabled;
+        }
+
+        /// Number of NUMA nodes (at least one).
+        int num_nodes();
+
+        /// The cpus belonging to a node.
+
+        /// \param[in] node Index of the node in \c [0,num_nodes()).
+        /// \return Ids of the cpus of \c node.
+        const std::vector<int>& node_cpus(int node);
+
+        /// The node on which the calling thread is currently running.
+
+        /// \return Index of the node or -1 if it cannot be determined.
+        int current_node();
+
+        /// Bind the calling thread to all cpus of a node.
+
+        /// \param[in] node Index of the node.
+        void bind_thread_to_node(int node);
+
+        /// Prefer placing the not-yet-touched pages of a block on the calling thread's node.
+
+        /// Only whole pages inside the block are affected; failure is
+        /// silently ignored since placement is only a performance hint.
+        /// \param[in] p Start of the block.
+        /// \param[in] nbyte Size of the block in bytes.
+        void bind_memory_local(void* p, std::size_t nbyte);
+
+        /// Blocks smaller than this are not worth a system call in \c bind_memory_local.
+        static const std::size_t min_bind_bytes = 65536;
+
+    } // namespace numa
+} // namespace madness
+
+#endif // MADNESS_WORLD_NUMA_H__INCLUDED
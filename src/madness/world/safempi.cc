@@ -53,6 +53,19 @@ namespace SafeMPI {
             child1 = -1;
     }
 
+    void Intracomm::k_ary_tree_info(int root, int k, int& parent, std::vector<int>& children) {
+        MADNESS_ASSERT(k >= 2);
+        const int np = Get_size();
+        const int me = (Get_rank() + np - root) % np; // Renumber processes so root has me=0
+        parent = (me == 0 ? -1 : ((me - 1) / k + root) % np);
+        children.clear();
+        for(int i = 1; i <= k; ++i) {
+            const long child = long(me) * k + i; // May overflow int for large k
+            if(child >= np) break;
+            children.push_back((int(child) + root) % np);
+        }
+    }
+
     // The logic here is to intended to cause an error if someone tries to use
     // this constructor from somewhere else.
 
@@ -73,6 +73,7 @@
 #include <cstring>
 #include <memory>
 #include <sstream>
+#include <vector>
 
 #define MADNESS_MPI_TEST(condition) \
     { \
@@ -830,6 +831,13 @@ namespace SafeMPI {
         /// there is no parent/child the value -1 will be set.
         void binary_tree_info(int root, int& parent, int& child0, int& child1);
 
+        /// Construct info about a k-ary tree with given root
+
+        /// As \c binary_tree_info but each process has up to \c k
+        /// children, which are returned in \c children.  For \c k=2
+        /// the tree is the same as that of \c binary_tree_info.
+        void k_ary_tree_info(int root, int k, int& parent, std::vector<int>& children);
+
     }; // class Intracomm
 
     namespace detail {
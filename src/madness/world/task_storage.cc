@@ -0,0 +1,173 @@
+/*
+  This file is part of MADNESS.
+
+  Copyright (C) 2007,2010 Oak Ridge National Laboratory
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+
+  For more information please contact:
+
+  Robert J. Harrison
+  Oak Ridge National Laboratory
+  One Bethel Valley Road
+  P.O. Box 2008, MS-6367
+
+  email: harrisonrj@ornl.gov
+  tel:   865-241-3937
+  fax:   865-572-0680
+*/
+
+/**
+ \file task_storage.cc
+ \brief Implementation of the pooled storage for task objects.
+ \ingroup world
+*/
+
+#include <madness/world/task_storage.h>
+#include <madness/world/worldmutex.h>
+#include <algorithm>
+#include <atomic>
+#include <new>
+
+namespace madness {
+
+    namespace detail {
+
+        namespace {
+
+            /// Free list and counters of one size class
+            struct TaskStorageClass {
+                Spinlock lock;
+                void* head = nullptr;        ///< Free blocks linked through their first word
+                std::size_t nfree = 0;       ///< No. of blocks on the free list
+                std::size_t retain = 0;      ///< Max. no. of free blocks kept
+                std::atomic<long> live{0};   ///< No. of live blocks while tracking
+                std::atomic<long> peak{0};   ///< Peak of live while tracking
+            };
+
+            TaskStorageClass storage[task_storage_nclass];
+            std::atomic<bool> tracking{false};
+            std::atomic<unsigned long> nhit{0};
+
+            inline std::size_t class_of(std::size_t size) {
+                return (size + task_storage_granule - 1)/task_storage_granule - 1;
+            }
+
+            inline std::size_t class_size(std::size_t c) {
+                return (c + 1)*task_storage_granule;
+            }
+
+        }
+
+        void* task_storage_allocate(std::size_t size) {
+            const std::size_t c = class_of(size);
+            if (size == 0 || c >= task_storage_nclass) return ::operator new(size);
+
+            TaskStorageClass& s = storage[c];
+            if (tracking.load(std::memory_order_relaxed)) {
+                const long n = ++s.live;
+                long p = s.peak.load(std::memory_order_relaxed);
+                while (n > p && !s.peak.compare_exchange_weak(p, n)) {}
+            }
+
+            void* p = nullptr;
+            if (s.nfree) {
+                ScopedMutex<Spinlock> lock(s.lock);
+                if (s.head) {
+                    p = s.head;
+                    s.head = *static_cast<void**>(p);
+                    --s.nfree;
+                }
+            }
+            if (p) {
+                nhit.fetch_add(1, std::memory_order_relaxed);
+                return p;
+            }
+            return ::operator new(class_size(c));
+        }
+
+        void task_storage_deallocate(void* p, std::size_t size) noexcept {
+            if (!p) return;
+            const std::size_t c = class_of(size);
+            if (size == 0 || c >= task_storage_nclass) {
+                ::operator delete(p);
+                return;
+            }
+
+            TaskStorageClass& s = storage[c];
+            if (tracking.load(std::memory_order_relaxed)) --s.live;
+            if (s.retain) {
+                ScopedMutex<Spinlock> lock(s.lock);
+                if (s.nfree < s.retain) {
+                    *static_cast<void**>(p) = s.head;
+                    s.head = p;
+                    ++s.nfree;
+                    return;
+                }
+            }
+            ::operator delete(p);
+        }
+
+        void task_storage_track(bool on) {
+            if (on) {
+                for (std::size_t c=0; c<task_storage_nclass; ++c) {
+                    storage[c].live = 0;
+                    storage[c].peak = 0;
+                }
+            }
+            tracking = on;
+        }
+
+        std::vector<std::size_t> task_storage_peak() {
+            std::vector<std::size_t> n(task_storage_nclass);
+            for (std::size_t c=0; c<task_storage_nclass; ++c) n[c] = std::max(0l, storage[c].peak.load());
+            return n;
+        }
+
+        void task_storage_reserve(const std::vector<std::size_t>& n) {
+            for (std::size_t c=0; c<std::min(n.size(), task_storage_nclass); ++c) {
+                TaskStorageClass& s = storage[c];
+                ScopedMutex<Spinlock> lock(s.lock);
+                s.retain = std::max(s.retain, n[c]);
+                while (s.nfree < n[c]) {
+                    void* p = ::operator new(class_size(c));
+                    *static_cast<void**>(p) = s.head;
+                    s.head = p;
+                    ++s.nfree;
+                }
+            }
+        }
+
+        void task_storage_release() {
+            for (std::size_t c=0; c<task_storage_nclass; ++c) {
+                TaskStorageClass& s = storage[c];
+                ScopedMutex<Spinlock> lock(s.lock);
+                s.retain = 0;
+                while (s.head) {
+                    void* p = s.head;
+                    s.head = *static_cast<void**>(p);
+                    ::operator delete(p);
+                }
+                s.nfree = 0;
+            }
+        }
+
+        unsigned long task_storage_hits() {
+            return nhit;
+        }
+
+    } // namespace detail
+
+} // namespace madness
@@ -0,0 +1,87 @@
+/*
+  This file is part of MADNESS.
+
+  Copyright (C) 2007,2010 Oak Ridge National Laboratory
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+
+  For more information please contact:
+
+  Robert J. Harrison
+  Oak Ridge National Laboratory
+  One Bethel Valley Road
+  P.O. Box 2008, MS-6367
+
+  email: harrisonrj@ornl.gov
+  tel:   865-241-3937
+  fax:   865-572-0680
+*/
+
+#ifndef MADNESS_WORLD_TASK_STORAGE_H__INCLUDED
+#define MADNESS_WORLD_TASK_STORAGE_H__INCLUDED
+
+/**
+ \file task_storage.h
+ \brief Pooled storage for task objects.
+ \ingroup world
+
+ Task objects are allocated through these functions (unless TBB
+ manages them).  Small objects are rounded up to a size class.  Blocks
+ of a class are kept on a free list when a capacity has been reserved
+ for it, so a repeated pattern of tasks whose peak usage was recorded
+ (see \c WorldTaskQueue::begin_capture) runs without calls to the
+ general purpose allocator.  Without a reservation the free lists stay
+ empty and every block goes straight back to \c ::operator delete.
+*/
+
+#include <cstddef>
+#include <vector>
+
+namespace madness {
+
+    namespace detail {
+
+        /// Granularity of the size classes of task objects
+        static const std::size_t task_storage_granule = 64;
+
+        /// Number of size classes ... larger objects are not pooled
+        static const std::size_t task_storage_nclass = 32;
+
+        /// Allocates storage for a task object of \c size bytes
+        void* task_storage_allocate(std::size_t size);
+
+        /// Frees storage obtained from task_storage_allocate
+        void task_storage_deallocate(void* p, std::size_t size) noexcept;
+
+        /// Starts (or stops) recording the peak number of live blocks of each size class
+        void task_storage_track(bool on);
+
+        /// Returns the peak number of live blocks of each size class since tracking started
+        std::vector<std::size_t> task_storage_peak();
+
+        /// Fills the free lists so that \c n[i] blocks of class \c i are available and retained
+        void task_storage_reserve(const std::vector<std::size_t>& n);
+
+        /// Drops all reservations and returns the free blocks to the system
+        void task_storage_release();
+
+        /// Returns the number of allocations served from the free lists
+        unsigned long task_storage_hits();
+
+    } // namespace detail
+
+} // namespace madness
+
+#endif // MADNESS_WORLD_TASK_STORAGE_H__INCLUDED
@@ -151,7 +151,10 @@ namespace madness {
 
         World* get_world() const { return const_cast<World*>(world); }
 
-        virtual ~TaskInterface() { if (completion) completion->notify(); }
+        virtual ~TaskInterface() {
+            if (epoch) --(epoch->ntask);
+            if (completion) completion->notify();
+        }
 
     }; // class TaskInterface
 
@@ -856,6 +859,7 @@ namespace madness {
 
 #ifdef HAVE_INTEL_TBB
         virtual tbb::task* execute() {
+            detail::EpochGuard guard(epoch);
             detail::run_function(result_, func_, arg1_, arg2_, arg3_, arg4_,
                     arg5_, arg6_, arg7_, arg8_, arg9_);
             return nullptr;
@@ -228,6 +228,48 @@ void test_time() {
     }
 }
 
+template <typename mapT>
+void bench_map(const char* name, int nbins, int nentries) {
+    typedef typename mapT::datumT datumT;
+    mapT a(nbins);
+    vector<int> v = random_perm(nentries);
+    double insert_used = madness::wall_time();
+    for (int i=0; i<nentries; ++i) {
+        a.insert(datumT(v[i],v[i]));
+    }
+    insert_used = madness::wall_time()-insert_used;
+    v = random_perm(nentries);
+    double sum = 0.0;
+    double find_used = madness::wall_time();
+    for (int i=0; i<nentries; ++i) {
+        sum += a.find(v[i])->second;
+    }
+    find_used = madness::wall_time()-find_used;
+    if (sum != 0.5*double(nentries)*(nentries-1)) cout << name << ": bad sum after find " << sum << endl;
+    v = random_perm(nentries);
+    double del_used = madness::wall_time();
+    for (int i=0; i<nentries; ++i) {
+        a.erase(v[i]);
+    }
+    del_used = madness::wall_time()-del_used;
+    if (a.size() != 0) cout << name << ": size should have been 0 " << a.size() << endl;
+    printf("%8s   nbin=%6d   nent=%8d   insert=%.1es/call   find=%.1es/call   del=%.1es/call\n",
+           name, nbins, nentries, insert_used/nentries, find_used/nentries, del_used/nentries);
+}
+
+void test_bench() {
+    // Compare the default (indexed) bins against plain linked-list bins
+    // for tables that grow far beyond the number of bins, as do the
+    // coefficient trees held in a WorldContainer (5011 bins)
+    typedef ConcurrentHashMap<int,double,Hash<int>,Hash_private::bin<int,double> > chainedT;
+    typedef ConcurrentHashMap<int,double> indexedT;
+    const int nbins = 5011;
+    for (int nentries=10000; nentries<=1000000; nentries*=10) {
+        bench_map<chainedT>("chained", nbins, nentries);
+        bench_map<indexedT>("indexed", nbins, nentries);
+    }
+}
+
 void do_test_random(ConcurrentHashMap<int,double>& a, size_t& count, double& sum) {
     typedef ConcurrentHashMap<int,double>::datumT datumT;
     typedef ConcurrentHashMap<int,double>::iterator iteratorT;
@@ -400,6 +442,7 @@ int main(int argc, char** argv) {
             test_time();
             test_thread();
             test_accessors();
+            test_bench();
         }
 
         cout << "Things seem to be working!\n";
@@ -1179,6 +1179,144 @@ void test15(World& world) {
   world.gop.fence();
 }
 
+class Hopper : public WorldObject<Hopper> {
+    AtomicInt n;
+public:
+    Hopper(World& world) : WorldObject<Hopper>(world) {
+        n = 0;
+        process_pending();
+    }
+
+    /// Counts a visit and spawns the next one on the next process
+    int hop(int nleft) {
+        n++;
+        if (nleft > 0) task((get_world().rank()+1)%get_world().size(), &Hopper::hop, nleft-1);
+        return nleft;
+    }
+
+    int count() const { return n; }
+};
+
+int epoch_plus_one(int i) { return i+1; }
+
+void test16(World& world) {
+    Hopper h(world);
+    world.gop.fence();
+
+    // An unrelated task that cannot run until gate is set ... a global
+    // fence would wait for it forever
+    Future<int> gate;
+    Future<int> blocked = world.taskq.add(epoch_plus_one, gate);
+
+    Epoch epoch(world);
+    const int nchain = 10, nhop = 5;
+    {
+        Epoch::Scope scope(epoch);
+        for (int i=0; i<nchain; ++i) h.task(world.rank(), &Hopper::hop, nhop);
+    }
+    epoch.fence();
+    MADNESS_CHECK(epoch.size() == 0);
+
+    long total = h.count();
+    world.gop.sum(total);
+    MADNESS_CHECK(total == long(world.size())*nchain*(nhop+1));
+    MADNESS_CHECK(!blocked.probe());
+
+    gate.set(1);
+    world.gop.fence();
+    MADNESS_CHECK(blocked.get() == 2);
+
+    if (world.rank() == 0) print("test16 (epoch fence) OK");
+}
+
+void test17(World& world) {
+    const long nproc = world.size(), me = world.rank();
+    const int fanout = world.gop.set_fanout(3);
+
+    // Start the future-based collectives, then do a blocking one meanwhile
+    Future<long> s = world.gop.isum(me+1);
+    const double a[3] = {double(me), 1.0, -2.0*me};
+    Future< std::vector<double> > v = world.gop.isum(a, 3);
+    Future<long> mx = world.gop.imax(me);
+    Future<std::string> b = world.gop.ibroadcast(std::string(me == nproc-1 ? "last" : ""), nproc-1);
+
+    long t = 1;
+    world.gop.sum(t);
+    MADNESS_CHECK(t == nproc);
+
+    MADNESS_CHECK(s.get() == nproc*(nproc+1)/2);
+    MADNESS_CHECK(v.get().size() == 3);
+    MADNESS_CHECK(v.get()[0] == double(nproc*(nproc-1)/2));
+    MADNESS_CHECK(v.get()[1] == double(nproc));
+    MADNESS_CHECK(v.get()[2] == -double(nproc*(nproc-1)));
+    MADNESS_CHECK(mx.get() == nproc-1);
+    MADNESS_CHECK(b.get() == "last");
+
+    world.gop.fence();
+    world.gop.set_fanout(fanout);
+
+    if (world.rank() == 0) print("test17 (future-based collectives) OK");
+}
+
+static long test18_square(long i) {
+    return i*i;
+}
+
+// One pass of a repeated computation: many small local tasks plus one
+// task sent to every process
+static long test18_pass(World& world, long n) {
+    std::vector< Future<long> > r;
+    r.reserve(n + world.size());
+    for (long i=0; i<n; ++i) r.push_back(world.taskq.add(test18_square, i));
+    for (ProcessID p=0; p<world.size(); ++p) r.push_back(world.taskq.add(p, test18_square, long(world.rank())));
+    world.gop.fence();
+    long sum = 0;
+    for (auto& f : r) sum += f.get();
+    return sum;
+}
+
+void test18(World& world) {
+    const long n = 20000, nproc = world.size(), me = world.rank();
+    const long expected = (n-1)*n*(2*n-1)/6 + nproc*me*me;
+
+    world.gop.fence();
+    double t0 = wall_time();
+    world.taskq.begin_capture();
+    MADNESS_CHECK(test18_pass(world, n) == expected);
+    const TaskCapture capture = world.taskq.end_capture();
+    const double tcapture = wall_time() - t0;
+
+    MADNESS_CHECK(capture.ntask == (unsigned long)(n + nproc));
+    MADNESS_CHECK(capture.nreceived == (unsigned long)(nproc - 1));
+    MADNESS_CHECK(capture.nsent.size() == std::size_t(nproc));
+    for (ProcessID p=0; p<nproc; ++p) MADNESS_CHECK(capture.nsent[p] == (p == me ? 0ul : 1ul));
+
+    const int npass = 5;
+    t0 = wall_time();
+    for (int i=0; i<npass; ++i) MADNESS_CHECK(test18_pass(world, n) == expected);
+    const double tplain = (wall_time() - t0)/npass;
+
+#ifndef HAVE_INTEL_TBB
+    const unsigned long hits = detail::task_storage_hits();
+#endif
+    t0 = wall_time();
+    world.taskq.begin_replay(capture);
+    for (int i=0; i<npass; ++i) MADNESS_CHECK(test18_pass(world, n) == expected);
+    world.taskq.end_replay();
+    const double treplay = (wall_time() - t0)/npass;
+#ifndef HAVE_INTEL_TBB
+    MADNESS_CHECK(detail::task_storage_hits() - hits >= (unsigned long)(n));
+#endif
+
+    // The replayed passes must give the same results after the storage is released
+    MADNESS_CHECK(test18_pass(world, n) == expected);
+
+    if (world.rank() == 0) {
+        print("test18 capture pass", tcapture, "plain pass", tplain, "replayed pass", treplay);
+        print("test18 (task capture and replay) OK");
+    }
+}
+
 inline bool is_odd(int i) {
     return i & 0x1;
 }
@@ -1352,6 +1490,9 @@ int main(int argc, char** argv) {
         test13(world);
         test14(world);
         test15(world);
+        test16(world);
+        test17(world);
+        test18(world);
 
         for (int i=0; i<10; ++i) {
           print("REPETITION",i);
@@ -43,6 +43,7 @@
 #include <madness/world/worldpapi.h>
 #include <madness/world/safempi.h>
 #include <madness/world/atomicint.h>
+#include <madness/world/numa.h>
 #include <cstring>
 #include <fstream>
 
@@ -345,6 +346,8 @@ namespace madness {
     ThreadPool::ThreadPool(int nthread)
     : threads(nullptr)
     , main_thread()
+    , deques(nullptr)
+    , work_stealing(false)
     , nthreads(nthread)
     , finish(false)
     {
@@ -374,11 +377,26 @@ namespace madness {
         tbb_control = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism, num_tbb_threads);
 #else
 
+        // NUMA mode implies work stealing since the per-thread deques
+        // serve as the node-local queues
+        numa::initialize();
+        work_stealing = default_work_stealing() || numa::enabled();
+        if (numa::enabled() && nthreads > 0) {
+            // Assign threads in contiguous blocks to nodes that have cpus
+            std::vector<int> nodes;
+            for (int node=0; node<numa::num_nodes(); ++node)
+                if (!numa::node_cpus(node).empty()) nodes.push_back(node);
+            thread_node.resize(nthreads);
+            for (int i=0; i<nthreads; ++i)
+                thread_node[i] = nodes[(long(i)*nodes.size())/nthreads];
+        }
         try {
             if (nthreads > 0)
                 threads = new ThreadPoolThread[nthreads];
             else
                 threads = 0;
+            if (work_stealing && nthreads > 0)
+                deques = new WSDeque<PoolTaskInterface*>[nthreads];
         }
         catch (...) {
             MADNESS_EXCEPTION("memory allocation failed", 0);
@@ -417,15 +435,70 @@ namespace madness {
         return nthread;
     }
 
+    // Get scheduling mode from the environment
+    bool ThreadPool::default_work_stealing() {
+        const char* cws = getenv("MAD_WORK_STEALING");
+        if (!cws) return false;
+        int ws = 0;
+        if (sscanf(cws, "%d", &ws) != 1)
+            MADNESS_EXCEPTION("MAD_WORK_STEALING is not an integer", 0);
+        return ws != 0;
+    }
+
+    int ThreadPool::pop_work_stealing(PoolTaskInterface** taskbuf) {
+        if (!queue.empty()) {
+            const int ntask = queue.pop_front(nmax, taskbuf, false);
+            if (ntask) return ntask;
+        }
+
+        const int me = this_pool_thread_index();
+        if (me >= 0 && deques[me].pop(taskbuf[0])) return 1;
+        if (nthreads == 0) return 0;
+
+        // Visit every other deque once starting from a random victim.  In
+        // NUMA mode a pool thread makes a first pass over its own node.
+        static thread_local unsigned int seed = 0;
+        if (seed == 0) seed = 2654435761u*(me+2);
+        seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+        const int first = seed % nthreads;
+        const bool local_first = (me >= 0) && !thread_node.empty();
+        for (int pass = (local_first ? 0 : 1); pass<2; ++pass) {
+            for (int i=0; i<nthreads; ++i) {
+                const int victim = (first + i) % nthreads;
+                if (victim == me) continue;
+                if (local_first && ((thread_node[victim] == thread_node[me]) != (pass == 0))) continue;
+                const bool got = (me >= 0) ? deques[me].steal_from(deques[victim], taskbuf[0])
+                                           : deques[victim].steal(taskbuf[0]);
+                if (got) return 1;
+            }
+        }
+        return 0;
+    }
+
     void ThreadPool::thread_main(ThreadPoolThread* const thread) {
         PROFILE_MEMBER_FUNC(ThreadPool);
-        thread->set_affinity(2, thread->get_pool_thread_index());
+        if (thread_node.empty())
+            thread->set_affinity(2, thread->get_pool_thread_index());
+        else
+            numa::bind_thread_to_node(thread_node[thread->get_pool_thread_index()]);
 
 #if !HAVE_PARSEC
 #define MULTITASK
 #ifdef  MULTITASK
-        while (!finish) {
-            run_tasks(true, thread);
+        if (work_stealing) {
+            // Never block in the queue since work may appear in any deque
+            MutexWaiter waiter;
+            while (!finish) {
+                if (run_tasks(false, thread))
+                    waiter.reset();
+                else
+                    waiter.wait();
+            }
+        }
+        else {
+            while (!finish) {
+                run_tasks(true, thread);
+            }
         }
 #else
         while (!finish) {
@@ -535,7 +608,20 @@ namespace madness {
 
     // Returns queue statistics
     const DQStats& ThreadPool::get_stats() {
-        return instance()->queue.get_stats();
+        ThreadPool* const pool = instance();
+        pool->stats = pool->queue.get_stats();
+        if (pool->work_stealing) {
+            for (int i=0; i<pool->nthreads; ++i) {
+                const DQStats& d = pool->deques[i].get_stats();
+                pool->stats.npush_back += d.npush_back;
+                pool->stats.npop_front += d.npop_front;
+                pool->stats.ngrow += d.ngrow;
+                pool->stats.nmax = std::max(pool->stats.nmax, d.nmax);
+                pool->stats.nsteal += d.nsteal;
+                pool->stats.nsteal_miss += d.nsteal_miss;
+            }
+        }
+        return pool->stats;
     }
 
 #if defined(MADNESS_DQ_USE_PREBUF) && defined(MADNESS_CXX_COMPILER_IS_ICC)
@@ -41,6 +41,8 @@
 #include <madness/world/thread_info.h>
 #include <madness/world/dqueue.h>
 #include <madness/world/function_traits.h>
+#include <madness/world/world_epoch.h>
+#include <madness/world/task_storage.h>
 #include <vector>
 #include <cstddef>
 #include <cstdio>
@@ -864,6 +866,9 @@ namespace madness {
 
     protected:
 
+        /// Epoch the task belongs to, or null; active while the task runs
+        detail::EpochCounters* epoch = nullptr;
+
         /// \todo Brief description needed.
 
         /// \todo Descriptions needed.
@@ -919,6 +924,7 @@ namespace madness {
             // A downside is this does not preserve any relationships between thread
             // numbering and the architecture ... more work ahead.
             int nthread = get_nthread();
+            detail::EpochGuard guard(epoch);
             if (nthread == 1) {
 #ifdef MADNESS_TASK_PROFILING
                 task_event_->start(id_, nthread, submit_time_);
@@ -1000,6 +1006,22 @@ namespace madness {
                     barrier = 0;
             }
         }
+
+        /// Allocates a task object from the pooled task storage.
+
+        /// \param[in] size The size of the task object.
+        /// \return Pointer to the storage.
+        static inline void* operator new(std::size_t size) {
+            return detail::task_storage_allocate(size);
+        }
+
+        /// Returns a task object to the pooled task storage.
+
+        /// \param[in] p Pointer to the task object.
+        /// \param[in] size The size of the task object.
+        static inline void operator delete(void* p, std::size_t size) noexcept {
+            detail::task_storage_deallocate(p, size);
+        }
 #if HAVE_PARSEC
 	    //////////// Parsec Related Begin ////////////////////
 	    parsec_task_t                       parsec_task;
@@ -1042,6 +1064,7 @@ namespace madness {
         /// \return Description needed.
         tbb::task* execute() {
             const int nthread = get_nthread();
+            detail::EpochGuard guard(epoch);
             run( TaskThreadEnv(nthread, 0) );
             return nullptr;
         }
@@ -1150,6 +1173,10 @@ namespace madness {
         ThreadPoolThread *threads; ///< Array of threads.
         ThreadPoolThread main_thread; ///< Placeholder for main thread tls.
         DQueue<PoolTaskInterface*> queue; ///< Queue of tasks.
+        WSDeque<PoolTaskInterface*>* deques; ///< Per-thread deques (work-stealing mode only).
+        bool work_stealing; ///< If true pool threads queue their tasks locally and steal when idle.
+        std::vector<int> thread_node; ///< NUMA node of each pool thread (NUMA mode only).
+        DQStats stats; ///< Combined statistics of the queue and deques.
         int nthreads; ///< Number of threads.
         volatile bool finish; ///< Set to true when time to stop.
         AtomicInt nfinished; ///< Thread pool exit counter.
@@ -1173,6 +1200,30 @@ namespace madness {
         /// \return The number of threads.
         int default_nthread();
 
+        /// Get the scheduling mode from the environment.
+
+        /// \return True if \c MAD_WORK_STEALING requests work stealing.
+        static bool default_work_stealing();
+
+        /// Index of the calling thread in the pool.
+
+        /// \return (0,...,nthread-1) or -1 if not a pool thread.
+        static int this_pool_thread_index() {
+            const ThreadBase* t = ThreadBase::this_thread();
+            return t ? t->get_pool_thread_index() : -1;
+        }
+
+        /// Fetch tasks in work-stealing mode ... never blocks.
+
+        /// Tasks are taken first from the shared queue, which holds
+        /// high-priority, multi-threaded and externally submitted tasks,
+        /// then from the calling thread's own deque (LIFO) and finally
+        /// stolen (FIFO) from the deque of a randomly chosen victim.  In
+        /// NUMA mode victims on the thief's own node are tried first.
+        /// \param[out] taskbuf Array of dimension at least \c nmax.
+        /// \return The number of tasks fetched ... might be zero.
+        int pop_work_stealing(PoolTaskInterface** taskbuf);
+
        /// Run the next task.
 
         /// \todo Verify and complete this documentation.
@@ -1224,7 +1275,8 @@ namespace madness {
 #else
 
             PoolTaskInterface* taskbuf[nmax];
-            int ntask = queue.pop_front(nmax, taskbuf, wait);
+            int ntask = work_stealing ? pop_work_stealing(taskbuf)
+                                      : queue.pop_front(nmax, taskbuf, wait);
 #ifdef MADNESS_TASK_PROFILING
             profiling::TaskEventList* event_list =
                     this_thread->profiler().new_list(ntask);
@@ -1327,6 +1379,16 @@ namespace madness {
 #else
             if (!task) MADNESS_EXCEPTION("ThreadPool: inserting a NULL task pointer", 1);
             int task_threads = task->get_nthread();
+            ThreadPool* const pool = instance();
+            // In work-stealing mode ordinary tasks spawned by a pool
+            // thread stay on that thread's deque
+            if (pool->work_stealing && (task_threads == 1) && !task->is_high_priority()) {
+                const int me = this_pool_thread_index();
+                if (me >= 0) {
+                    pool->deques[me].push(task);
+                    return;
+                }
+            }
             // Currently multithreaded tasks must be shoved on the end of the q
             // to avoid a race condition as multithreaded task is starting up
             if (task->is_high_priority() && (task_threads == 1)) {
@@ -1405,7 +1467,12 @@ namespace madness {
 
         /// \return The number of tasks in the queue.
         static std::size_t queue_size() {
-            return instance()->queue.size();
+            const ThreadPool* const pool = instance();
+            std::size_t n = pool->queue.size();
+            if (pool->work_stealing) {
+                for (int i=0; i<pool->nthreads; ++i) n += pool->deques[i].size();
+            }
+            return n;
         }
 
         /// Returns queue statistics.
@@ -1488,6 +1555,7 @@ namespace madness {
 #elif HAVE_INTEL_TBB
 #else
             delete[] threads;
+            delete[] deques;
 #endif
         }
 
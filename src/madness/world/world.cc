@@ -41,6 +41,7 @@
 #include <madness/world/worldam.h>
 #include <madness/world/world_task_queue.h>
 #include <madness/world/worldgop.h>
+#include <algorithm>
 #include <cstdlib>
 #include <sstream>
 
@@ -288,6 +289,16 @@ namespace madness {
         double nbyte_sent = rmi.nbyte_sent;
         double nbyte_recv = rmi.nbyte_recv;
         double server_q = rmi.max_serv_send_q;
+        double nagg_sent = rmi.naggregate_sent;
+        double nmsg_agg = rmi.nmsg_aggregated;
+        double nmsg_shm = rmi.nmsg_shm_sent;
+        double nbyte_agg = rmi.nbyte_aggregated;
+        double msg_rate = rmi.nmsg_sent/total_wall_time;
+        world.gop.sum(nagg_sent);
+        world.gop.sum(nmsg_agg);
+        world.gop.sum(nmsg_shm);
+        world.gop.sum(nbyte_agg);
+        world.gop.sum(msg_rate);
         world.gop.sum(nmsg_sent);
         world.gop.sum(nmsg_recv);
         world.gop.sum(nbyte_sent);
@@ -299,6 +310,12 @@ namespace madness {
         double max_nbyte_sent = rmi.nbyte_sent;
         double max_nbyte_recv = rmi.nbyte_recv;
         double max_server_q = rmi.max_serv_send_q;
+        double max_nmsg_agg = rmi.nmsg_aggregated;
+        double max_nmsg_shm = rmi.nmsg_shm_sent;
+        world.gop.max(max_nmsg_shm);
+        double max_msg_rate = rmi.nmsg_sent/total_wall_time;
+        world.gop.max(max_nmsg_agg);
+        world.gop.max(max_msg_rate);
         world.gop.max(max_nmsg_sent);
         world.gop.max(max_nmsg_recv);
         world.gop.max(max_nbyte_sent);
@@ -310,6 +327,12 @@ namespace madness {
         double min_nbyte_sent = rmi.nbyte_sent;
         double min_nbyte_recv = rmi.nbyte_recv;
         double min_server_q = rmi.max_serv_send_q;
+        double min_nmsg_agg = rmi.nmsg_aggregated;
+        double min_nmsg_shm = rmi.nmsg_shm_sent;
+        world.gop.min(min_nmsg_shm);
+        double min_msg_rate = rmi.nmsg_sent/total_wall_time;
+        world.gop.min(min_nmsg_agg);
+        world.gop.min(min_msg_rate);
         world.gop.min(min_nmsg_sent);
         world.gop.min(min_nmsg_recv);
         world.gop.min(min_nbyte_sent);
@@ -321,33 +344,45 @@ namespace madness {
         double npop_front = q.npop_front;
         double ntask = q.npush_back + q.npush_front;
         double nmax = q.nmax;
+        double nsteal = q.nsteal;
+        double nsteal_miss = q.nsteal_miss;
         world.gop.sum(npush_back);
         world.gop.sum(npush_front);
         world.gop.sum(npop_front);
         world.gop.sum(ntask);
         world.gop.sum(nmax);
+        world.gop.sum(nsteal);
+        world.gop.sum(nsteal_miss);
 
         double max_npush_back = q.npush_back;
         double max_npush_front = q.npush_front;
         double max_npop_front = q.npop_front;
         double max_ntask = q.npush_back + q.npush_front;
         double max_nmax = q.nmax;
+        double max_nsteal = q.nsteal;
+        double max_nsteal_miss = q.nsteal_miss;
         world.gop.max(max_npush_back);
         world.gop.max(max_npush_front);
         world.gop.max(max_npop_front);
         world.gop.max(max_ntask);
         world.gop.max(max_nmax);
+        world.gop.max(max_nsteal);
+        world.gop.max(max_nsteal_miss);
 
         double min_npush_back = q.npush_back;
         double min_npush_front = q.npush_front;
         double min_npop_front = q.npop_front;
         double min_ntask = q.npush_back + q.npush_front;
         double min_nmax = q.nmax;
+        double min_nsteal = q.nsteal;
+        double min_nsteal_miss = q.nsteal_miss;
         world.gop.min(min_npush_back);
         world.gop.min(min_npush_front);
         world.gop.min(min_npop_front);
         world.gop.min(min_ntask);
         world.gop.min(min_nmax);
+        world.gop.min(min_nsteal);
+        world.gop.min(min_nsteal_miss);
 
 #ifdef HAVE_PAPI
         double val[NUMEVENTS], max_val[NUMEVENTS], min_val[NUMEVENTS];
@@ -386,8 +421,23 @@ namespace madness {
                    min_nmsg_recv, nmsg_recv/world.size(), max_nmsg_recv);
             printf("    #bytes recv per node    %.2e / %.2e / %.2e\n",
                    min_nbyte_recv, nbyte_recv/world.size(), max_nbyte_recv);
+            printf("    #messages/s per node    %.2e / %.2e / %.2e\n",
+                   min_msg_rate, msg_rate/world.size(), max_msg_rate);
             printf("        #msgs systemwide    %.2e\n", nmsg_sent);
             printf("       #bytes systemwide    %.2e\n", nbyte_sent);
+            printf("      #bytes per message    %.2e\n", nbyte_sent/std::max(nmsg_sent,1.0));
+            if (nmsg_shm > 0) {
+                printf(" #shm msgs sent per node    %.2e / %.2e / %.2e\n",
+                       min_nmsg_shm, nmsg_shm/world.size(), max_nmsg_shm);
+            }
+            if (nmsg_agg > 0) {
+                // AM packed into aggregate messages (MAD_AM_AGGREGATE) are
+                // not counted individually in #messages sent
+                printf(" #AM aggregated per node    %.2e / %.2e / %.2e\n",
+                       min_nmsg_agg, nmsg_agg/world.size(), max_nmsg_agg);
+                printf("   #AM per aggregate msg    %.2e\n", nmsg_agg/std::max(nagg_sent,1.0));
+                printf("#bytes per aggregated AM    %.2e\n", nbyte_agg/nmsg_agg);
+            }
             printf("\n");
             printf("  Thread pool statistics (min / avg / max)\n");
             printf("  ----------------------\n");
@@ -397,6 +447,10 @@ namespace madness {
                    min_nmax, nmax/world.size(), max_nmax);
             printf("  #hi-pri tasks per node    %.2e / %.2e / %.2e\n",
                    min_npush_front, npush_front/world.size(), max_npush_front);
+            printf("  #stolen tasks per node    %.2e / %.2e / %.2e\n",
+                   min_nsteal, nsteal/world.size(), max_nsteal);
+            printf(" #failed steals per node    %.2e / %.2e / %.2e\n",
+                   min_nsteal_miss, nsteal_miss/world.size(), max_nsteal_miss);
             printf("\n");
 #ifdef HAVE_PAPI
             printf("         PAPI statistics (min / avg / max)\n");
@@ -415,7 +469,7 @@ namespace madness {
             }
             printf("\n");
 #endif
-#ifdef WORLD_GATHER_MEM_STATS
+#if defined(WORLD_GATHER_MEM_STATS) || defined(TENSOR_USE_POOL_ALLOCATOR)
             world_mem_info()->print();
 #endif
 
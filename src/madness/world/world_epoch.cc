@@ -0,0 +1,95 @@
+/*
+  This file is part of MADNESS.
+
+  Copyright (C) 2007,2010 Oak Ridge National Laboratory
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+
+  For more information please contact:
+
+  Robert J. Harrison
+  Oak Ridge National Laboratory
+  One Bethel Valley Road
+  P.O. Box 2008, MS-6367
+
+  email: harrisonrj@ornl.gov
+  tel:   865-241-3937
+  fax:   865-572-0680
+*/
+
+/**
+ \file world_epoch.cc
+ \brief Implementation of \c Epoch.
+ \ingroup world
+*/
+
+#include <madness/world/world_epoch.h>
+#include <madness/world/MADworld.h>
+#include <map>
+#include <memory>
+#include <utility>
+
+namespace madness {
+
+    namespace detail {
+
+        thread_local EpochCounters* current_epoch = nullptr;
+
+        /// Counters of all epochs of all worlds on this process
+        static std::map<std::pair<unsigned long,unsigned long>, std::unique_ptr<EpochCounters> > epoch_registry;
+        static Mutex epoch_registry_mutex;
+
+        EpochCounters* epoch_counters(const World& world, unsigned long id) {
+            const auto key = std::make_pair(world.id(), id);
+            ScopedMutex<Mutex> lock(epoch_registry_mutex);
+            std::unique_ptr<EpochCounters>& e = epoch_registry[key];
+            if (!e) e.reset(new EpochCounters(id));
+            return e.get();
+        }
+
+    } // namespace detail
+
+    Epoch::Epoch(World& world)
+        : world_(world)
+        , counters_(detail::epoch_counters(world, world.unique_obj_id().get_obj_id()))
+    {}
+
+    Epoch::~Epoch() {
+        MADNESS_ASSERT(counters_->ntask == 0);
+        const auto key = std::make_pair(world_.id(), counters_->id);
+        ScopedMutex<Mutex> lock(detail::epoch_registry_mutex);
+        detail::epoch_registry.erase(key);
+    }
+
+    void Epoch::fence() {
+        detail::EpochCounters* e = counters_;
+        unsigned long prev[2] = {1, 0}; // invalid initial condition
+        while (true) {
+            // Run tasks until those of the epoch are done, then make sure
+            // aggregated messages are on their way
+            ThreadPool::await([e]() { return e->ntask == 0; }, true);
+            world_.am.fence();
+
+            // The epoch is complete once all messages sent have been
+            // handled and nothing changed since the previous pass
+            unsigned long sum[2] = {e->nsent, e->nrecv};
+            world_.gop.sum(sum, 2);
+            if (sum[0] == sum[1] && sum[0] == prev[0] && sum[1] == prev[1]) break;
+            prev[0] = sum[0];
+            prev[1] = sum[1];
+        }
+    }
+
+} // namespace madness
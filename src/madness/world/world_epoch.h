@@ -0,0 +1,141 @@
+/*
+  This file is part of MADNESS.
+
+  Copyright (C) 2007,2010 Oak Ridge National Laboratory
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+
+  For more information please contact:
+
+  Robert J. Harrison
+  Oak Ridge National Laboratory
+  One Bethel Valley Road
+  P.O. Box 2008, MS-6367
+
+  email: harrisonrj@ornl.gov
+  tel:   865-241-3937
+  fax:   865-572-0680
+*/
+
+#ifndef MADNESS_WORLD_WORLD_EPOCH_H__INCLUDED
+#define MADNESS_WORLD_WORLD_EPOCH_H__INCLUDED
+
+/**
+ \file world_epoch.h
+ \brief Scoped completion of tasks and active messages.
+ \ingroup world
+
+ A \c World::gop.fence() waits until \em all tasks and active messages
+ of the world have completed.  An \c Epoch instead counts only the work
+ spawned while it is active, so that a fence on it does not wait for
+ unrelated work that may still be in flight:
+
+ \code
+   Epoch epoch(world);                 // collective
+   {
+       Epoch::Scope scope(epoch);      // work submitted from here on is counted
+       for (auto& f : v) f.compress(false);
+   }
+   ... submit unrelated work ...
+   epoch.fence();                      // collective, waits only for the compress
+ \endcode
+
+ A task inherits the epoch that was active when it was added to the
+ task queue, and an active message inherits the epoch that was active
+ when it was sent; tasks and messages spawned in turn while they run
+ belong to the same epoch.  The fence is a termination-detection loop
+ like \c WorldGopInterface::fence but over the epoch's counters only.
+
+ \attention An epoch must be fenced before it is destroyed.  Messages
+ to a \c WorldObject that has not yet been constructed on the receiving
+ process are counted when they arrive, but the work they spawn once the
+ object exists is not part of the epoch.
+*/
+
+#include <atomic>
+
+namespace madness {
+
+    class World;
+
+    namespace detail {
+
+        /// Counters of the work belonging to an epoch on this process
+        struct EpochCounters {
+            const unsigned long id;        ///< The object id of the epoch within its world
+            std::atomic<long> ntask;       ///< No. of local tasks not yet completed
+            std::atomic<unsigned long> nsent; ///< No. of active messages sent
+            std::atomic<unsigned long> nrecv; ///< No. of active messages received and handled
+
+            explicit EpochCounters(unsigned long id) : id(id), ntask(0), nsent(0), nrecv(0) {}
+        };
+
+        /// The epoch active in this thread, or null
+        extern thread_local EpochCounters* current_epoch;
+
+        /// Returns the counters of epoch \c id of \c world, creating them if need be
+
+        /// Used when a message arrives for an epoch not yet constructed here.
+        EpochCounters* epoch_counters(const World& world, unsigned long id);
+
+        /// Makes \c e the epoch of this thread until destroyed
+        class EpochGuard {
+            EpochCounters* prev;
+        public:
+            explicit EpochGuard(EpochCounters* e) : prev(current_epoch) { current_epoch = e; }
+            ~EpochGuard() { current_epoch = prev; }
+            EpochGuard(const EpochGuard&) = delete;
+            EpochGuard& operator=(const EpochGuard&) = delete;
+        };
+
+    } // namespace detail
+
+    /// Counts and waits for the tasks and active messages spawned under it
+    class Epoch {
+        World& world_;
+        detail::EpochCounters* counters_;
+
+    public:
+        /// Makes \c e the active epoch of this thread for the lifetime of the scope
+        class Scope : private detail::EpochGuard {
+        public:
+            explicit Scope(Epoch& e) : detail::EpochGuard(e.counters_) {}
+        };
+
+        /// Collective constructor ... must be called in the same order as
+        /// other world objects on all processes of \c world
+        explicit Epoch(World& world);
+
+        Epoch(const Epoch&) = delete;
+        Epoch& operator=(const Epoch&) = delete;
+
+        ~Epoch();
+
+        /// Returns the world of this epoch
+        World& get_world() const { return world_; }
+
+        /// Returns the number of local tasks of this epoch not yet completed
+        long size() const { return counters_->ntask; }
+
+        /// Returns after all tasks and active messages of this epoch have completed on all processes
+
+        /// Collective.  While waiting the calling thread runs tasks,
+        /// including tasks that do not belong to the epoch.
+        void fence();
+    };
+
+} // namespace madness
+
+#endif // MADNESS_WORLD_WORLD_EPOCH_H__INCLUDED
@@ -36,6 +36,8 @@
 */
 
 #include <madness/world/world_task_queue.h>
+#include <madness/world/world.h>
+#include <madness/world/task_storage.h>
 
 namespace madness {
 
@@ -57,4 +59,41 @@ namespace madness {
         nregistered = 0;
     }
 
+    void WorldTaskQueue::begin_capture() {
+        MADNESS_ASSERT(!capturing);
+        const std::size_t nproc = world.size();
+        ncapture_sent.reset(new std::atomic<unsigned long>[nproc]);
+        for (std::size_t p=0; p<nproc; ++p) ncapture_sent[p] = 0;
+        ncapture_task = 0;
+        ncapture_received = 0;
+        detail::task_storage_track(true);
+        capturing = true;
+    }
+
+    TaskCapture WorldTaskQueue::end_capture() {
+        MADNESS_ASSERT(capturing);
+        capturing = false;
+        detail::task_storage_track(false);
+
+        TaskCapture capture;
+        capture.ntask = ncapture_task;
+        capture.nreceived = ncapture_received;
+        capture.nsent.resize(world.size());
+        for (std::size_t p=0; p<capture.nsent.size(); ++p) capture.nsent[p] = ncapture_sent[p];
+        capture.peak = detail::task_storage_peak();
+        return capture;
+    }
+
+    void WorldTaskQueue::begin_replay(const TaskCapture& capture) {
+#ifndef HAVE_INTEL_TBB
+        detail::task_storage_reserve(capture.peak);
+#endif
+    }
+
+    void WorldTaskQueue::end_replay() {
+#ifndef HAVE_INTEL_TBB
+        detail::task_storage_release();
+#endif
+    }
+
 }  // namespace madness
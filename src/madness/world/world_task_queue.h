@@ -40,6 +40,9 @@
 
 #include <type_traits>
 #include <iostream>
+#include <atomic>
+#include <memory>
+#include <vector>
 #include <madness/world/meta.h>
 #include <madness/world/nodefaults.h>
 #include <madness/world/range.h>
@@ -309,6 +312,19 @@ namespace madness {
     }  // namespace detail
 
 
+    /// Summary of the tasks created by one pass of a repeated computation.
+
+    /// Recorded by \c WorldTaskQueue::begin_capture() and
+    /// \c WorldTaskQueue::end_capture(), and passed to
+    /// \c WorldTaskQueue::begin_replay() to prepare for the next pass.
+    struct TaskCapture {
+        unsigned long ntask = 0;              ///< No. of tasks added to this queue
+        unsigned long nreceived = 0;          ///< No. of those that arrived from other processes
+        std::vector<unsigned long> nsent;     ///< No. of tasks sent to each process
+        std::vector<std::size_t> peak;        ///< Peak no. of live task objects in each storage size class
+    };
+
+
     /// Multi-threaded queue to manage and run tasks.
 
     /// \todo A concise description of the inner workings...
@@ -318,6 +334,10 @@ namespace madness {
         World& world; ///< The communication context.
         const ProcessID me; ///< This process.
         AtomicInt nregistered; ///< Count of pending tasks.
+        std::atomic<bool> capturing{false}; ///< True between begin_capture() and end_capture()
+        std::atomic<unsigned long> ncapture_task{0}; ///< Tasks added while capturing
+        std::atomic<unsigned long> ncapture_received{0}; ///< Remote tasks received while capturing
+        std::unique_ptr<std::atomic<unsigned long>[]> ncapture_sent; ///< Tasks sent to each process while capturing
 
         /// \todo Brief description needed.
         void notify() {
@@ -361,7 +381,10 @@ namespace madness {
                     info.func, info.attr, input_arch);
 
             // Add task to queue
-            arg.get_world()->taskq.add(task);
+            WorldTaskQueue& taskq = arg.get_world()->taskq;
+            if (taskq.capturing.load(std::memory_order_relaxed))
+                taskq.ncapture_received.fetch_add(1, std::memory_order_relaxed);
+            taskq.add(task);
         }
 
         /// \todo Brief description needed.
@@ -426,6 +449,8 @@ namespace madness {
                 const TaskAttributes& attr)
         {
             typename taskT::futureT result;
+            if (capturing.load(std::memory_order_relaxed))
+                ncapture_sent[where].fetch_add(1, std::memory_order_relaxed);
             typedef detail::TaskHandlerInfo<typename taskT::futureT::remote_refT, typename taskT::functionT> infoT;
             world.am.send(where, & WorldTaskQueue::template remote_task_handler<taskT>,
                     new_am_arg(infoT(result.remote_ref(world), fn, attr),
@@ -464,6 +489,13 @@ namespace madness {
 
             t->set_info(&world, this);       // Stuff info
 
+            // The task belongs to the epoch active in this thread, if any
+            t->epoch = detail::current_epoch;
+            if (t->epoch) ++(t->epoch->ntask);
+
+            if (capturing.load(std::memory_order_relaxed))
+                ncapture_task.fetch_add(1, std::memory_order_relaxed);
+
             // Always use the callback to avoid race condition
             t->register_submit_callback();
         }
@@ -1385,6 +1417,34 @@ namespace madness {
                 throw;
             }
         }
+
+        /// Starts recording the tasks created by one pass of a repeated computation.
+
+        /// Call with no tasks pending (e.g., after a fence).  Records
+        /// the number of tasks added to and sent from this queue, and
+        /// the peak number of live task objects per storage size class.
+        /// The latter is a property of the process, so only one world
+        /// should capture at a time.
+        void begin_capture();
+
+        /// Stops recording and returns the summary.
+
+        /// Call after a fence so that all tasks of the pass have run.
+        /// \return The summary of the captured pass.
+        TaskCapture end_capture();
+
+        /// Prepares to run another pass like the one in \c capture.
+
+        /// Task storage is preallocated from the recorded peaks and kept
+        /// until \c end_replay(), so that creating and destroying the
+        /// tasks of each pass does not go to the general purpose
+        /// allocator.  Passes may be run repeatedly before \c end_replay().
+        /// Without TBB only; with TBB this does nothing.
+        /// \param[in] capture The summary from \c end_capture().
+        void begin_replay(const TaskCapture& capture);
+
+        /// Returns the task storage retained by \c begin_replay() to the system.
+        void end_replay();
     };
 
     namespace detail {
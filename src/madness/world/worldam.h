@@ -38,6 +38,7 @@
 #include <madness/world/buffer_archive.h>
 #include <madness/world/worldrmi.h>
 #include <madness/world/world.h>
+#include <madness/world/world_epoch.h>
 #include <vector>
 #include <cstddef>
 #include <memory>
@@ -90,9 +91,10 @@ namespace madness {
         std::ptrdiff_t func;    // User function to call, as a relative fn ptr (see archive::to_rel_fn_ptr)
         ProcessID src;          // Rank of process sending the message
         unsigned int flags;     // Misc. bit flags
+        unsigned long epochid;  // Object id of the epoch of the message, or 0 (see world_epoch.h)
 
-        // On 32 bit machine AmArg is HEADER_LEN+4+4+4+4+4=84 bytes
-        // On 64 bit machine AmArg is HEADER_LEN+8+8+8+4+4=96 bytes
+        // On 32 bit machine AmArg is HEADER_LEN+4+4+4+4+4+4=88 bytes
+        // On 64 bit machine AmArg is HEADER_LEN+8+8+8+4+4+8=104 bytes
 
         // No copy constructor or assignment
         AmArg(const AmArg&);
@@ -109,6 +111,10 @@ namespace madness {
 
         void set_size(std::size_t numbyte) { nbyte = numbyte; }
 
+        void set_epochid(unsigned long id) { epochid = id; }
+
+        unsigned long get_epochid() const { return epochid; }
+
         void set_pending() { flags |= 0x1ul; }
 
         bool is_pending() const { return flags & 0x1ul; }
@@ -261,7 +267,18 @@ namespace madness {
             MADNESS_ASSERT(arg->size() + sizeof(AmArg) == nbyte);
             MADNESS_ASSERT(w);
             MADNESS_ASSERT(func);
-            func(*arg);
+            if (arg->get_epochid()) {
+                // Work spawned by the handler belongs to the epoch of the message
+                detail::EpochCounters* e = detail::epoch_counters(*w, arg->get_epochid());
+                {
+                    detail::EpochGuard guard(e);
+                    func(*arg);
+                }
+                ++(e->nrecv);
+            }
+            else {
+                func(*arg);
+            }
             w->am.nrecv++;  // Must be AFTER execution of the function
         }
 
@@ -270,8 +287,8 @@ namespace madness {
 
         virtual ~WorldAmInterface();
 
-        /// Currently a noop
-        void fence() {}
+        /// Sends the active messages waiting in aggregate buffers (see RMI::aggregate)
+        void fence() { RMI::flush_aggregated(); }
 
         /// Sends a managed non-blocking active message
         void send(ProcessID dest, am_handlerT op, const AmArg* arg,
@@ -285,6 +302,10 @@ namespace madness {
                 argx->set_src(rank);
                 argx->set_func(op);
                 argx->clear_flags(); // Is this the right place for this?
+
+                detail::EpochCounters* e = detail::current_epoch;
+                argx->set_epochid(e ? e->id : 0);
+                if (e) ++(e->nsent);
             }
 
             // Sanity check
@@ -294,6 +315,15 @@ namespace madness {
             // Map dest from world's communicator to comm_world
             dest = map_to_comm_world[dest];
 
+            // Small messages are copied into the aggregate buffer for
+            // dest, if enabled, so the argument can be freed right away
+            if (RMI::can_aggregate(arg->size()+sizeof(AmArg))) {
+                lock(); nsent++; unlock();
+                RMI::aggregate(arg, arg->size()+sizeof(AmArg), dest, handler);
+                free_am_arg(const_cast<AmArg*>(arg));
+                return;
+            }
+
             // Remaining code refactored to avoid blocking with lock
             // and to enable finer grained calls into MPI send
 
@@ -29,7 +29,10 @@
   fax:   865-572-0680
 */
 
+#include <cstdlib>
 #include <limits>
+#include <sstream>
+#include <vector>
 #include <madness/world/worldgop.h>
 #include <madness/world/MADworld.h>
 #ifdef MADNESS_HAS_GOOGLE_PERF_TCMALLOC
@@ -53,9 +56,13 @@ namespace madness {
         PROFILE_MEMBER_FUNC(WorldGopInterface);
         MADNESS_CHECK(not forbid_fence_);
         unsigned long nsent_prev=0, nrecv_prev=1; // invalid initial condition
-        SafeMPI::Request req0, req1;
-        ProcessID parent, child0, child1;
-        world_.mpi.binary_tree_info(0, parent, child0, child1);
+        SafeMPI::Request req0;
+        ProcessID parent;
+        std::vector<ProcessID> children;
+        tree_info(0, parent, children);
+        const std::size_t nchild = children.size();
+        std::vector<SafeMPI::Request> reqs(nchild);
+        std::vector<uint64_t> sums(2*nchild);
         Tag gfence_tag = world_.mpi.unique_tag();
         Tag bcast_tag = world_.mpi.unique_tag();
         int npass = 0;
@@ -66,20 +73,20 @@ namespace madness {
         madness::print(world_.rank(), ": WORLD.GOP.FENCE: entering fence loop, gfence_tag=", gfence_tag, " bcast_tag=", bcast_tag);
 
       while (1) {
-            uint64_t sum0[2]={0,0}, sum1[2]={0,0}, sum[2];
-            if (child0 != -1) req0 = world_.mpi.Irecv((void*) &sum0, sizeof(sum0), MPI_BYTE, child0, gfence_tag);
-            if (child1 != -1) req1 = world_.mpi.Irecv((void*) &sum1, sizeof(sum1), MPI_BYTE, child1, gfence_tag);
+            uint64_t sum[2];
+            for (std::size_t c=0; c<nchild; ++c)
+                reqs[c] = world_.mpi.Irecv((void*) &sums[2*c], 2*sizeof(uint64_t), MPI_BYTE, children[c], gfence_tag);
             world_.taskq.fence();
-            if (child0 != -1) World::await(req0);
-            if (child1 != -1) World::await(req1);
+            for (std::size_t c=0; c<nchild; ++c) World::await(reqs[c]);
 
-            if (debug && (child0 != -1 || child1 != -1))
-              madness::print(world_.rank(), ": WORLD.GOP.FENCE: npass=", npass, " received messages from children={", child0, ",", child1, "} gfence_tag=", gfence_tag);
+            if (debug && nchild)
+              madness::print(world_.rank(), ": WORLD.GOP.FENCE: npass=", npass, " received messages from children=", children, " gfence_tag=", gfence_tag);
 
             bool finished;
             uint64_t ntask1, nsent1, nrecv1, ntask2, nsent2, nrecv2;
             do {
                 world_.taskq.fence();
+                world_.am.fence();
 
                 // Since the number of outstanding tasks and number of AM sent/recv
                 // don't share a critical section read each twice and ensure they
@@ -102,8 +109,12 @@ namespace madness {
             }
             while (!finished);
 
-            sum[0] = sum0[0] + sum1[0] + nsent2; // Must use values read above
-            sum[1] = sum0[1] + sum1[1] + nrecv2;
+            sum[0] = nsent2; // Must use values read above
+            sum[1] = nrecv2;
+            for (std::size_t c=0; c<nchild; ++c) {
+                sum[0] += sums[2*c];
+                sum[1] += sums[2*c+1];
+            }
 
             if (parent != -1) {
                 req0 = world_.mpi.Isend(&sum, sizeof(sum), MPI_BYTE, parent, gfence_tag);
@@ -158,6 +169,17 @@ namespace madness {
         madness::print(world_.rank(), ": WORLD.GOP.FENCE: done with fence in ", npass, (npass > 1 ? " loops" : " loop"));
     }
 
+    int WorldGopInterface::default_fanout() {
+        int k = 2;
+        const char* sk = getenv("MAD_GOP_FANOUT");
+        if (sk) {
+            std::stringstream ss(sk);
+            ss >> k;
+            if (k < 2) k = 2;
+        }
+        return k;
+    }
+
     void WorldGopInterface::fence(bool debug) {
       fence_impl([]{}, false, debug);
     }
@@ -171,23 +193,23 @@ namespace madness {
     }
 
     /// Broadcasts bytes from process root while still processing AM & tasks
-    static void broadcast_impl(void* buf, int nbyte, ProcessID root, bool dowork, Tag bcast_tag, World &world) {
-        SafeMPI::Request req0, req1;
-        ProcessID parent, child0, child1;
-        world.mpi.binary_tree_info(root, parent, child0, child1);
+    static void broadcast_impl(void* buf, int nbyte, ProcessID root, bool dowork, Tag bcast_tag, int fanout, World &world) {
+        ProcessID parent;
+        std::vector<ProcessID> children;
+        world.mpi.k_ary_tree_info(root, fanout, parent, children);
 
         //print("BCAST TAG", bcast_tag);
 
         if (parent != -1) {
-            req0 = world.mpi.Irecv(buf, nbyte, MPI_BYTE, parent, bcast_tag);
-            World::await(req0, dowork);
+            SafeMPI::Request req = world.mpi.Irecv(buf, nbyte, MPI_BYTE, parent, bcast_tag);
+            World::await(req, dowork);
         }
 
-        if (child0 != -1) req0 = world.mpi.Isend(buf, nbyte, MPI_BYTE, child0, bcast_tag);
-        if (child1 != -1) req1 = world.mpi.Isend(buf, nbyte, MPI_BYTE, child1, bcast_tag);
-
-        if (child0 != -1) World::await(req0, dowork);
-        if (child1 != -1) World::await(req1, dowork);
+        std::vector<SafeMPI::Request> reqs(children.size());
+        for (std::size_t c=0; c<children.size(); ++c)
+            reqs[c] = world.mpi.Isend(buf, nbyte, MPI_BYTE, children[c], bcast_tag);
+        for (std::size_t c=0; c<children.size(); ++c)
+            World::await(reqs[c], dowork);
     }
 
     /// Optimizations can be added for long messages
@@ -197,7 +219,7 @@ namespace madness {
       const size_t int_max = static_cast<size_t>(std::numeric_limits<int>::max());
       while (nbyte) {
         const int n = static_cast<int>(std::min(int_max, nbyte));
-        broadcast_impl(buf, n, root, dowork, bcast_tag, world_);
+        broadcast_impl(buf, n, root, dowork, bcast_tag, fanout_, world_);
         nbyte -= n;
         buf = static_cast<char*>(buf) + n;
       }
@@ -40,6 +40,7 @@
 
 #include <functional>
 #include <type_traits>
+#include <vector>
 #include <madness/world/worldtypes.h>
 #include <madness/world/buffer_archive.h>
 #include <madness/world/world.h>
@@ -58,6 +59,33 @@ namespace madness {
 
         class DeferredCleanup;
 
+        /// Elementwise reduction of vectors with a binary operation such as \c WorldSumOp
+
+        /// Adapts the operations used by \c WorldGopInterface::reduce to the
+        /// reduce functor interface of the future-based collectives.  An empty
+        /// vector is the identity.
+        template <typename T, typename opT>
+        struct ElementwiseReduceOp {
+            typedef std::vector<T> result_type;
+            typedef std::vector<T> argument_type;
+
+            opT op;
+
+            ElementwiseReduceOp(const opT& op) : op(op) { }
+
+            result_type operator()() const { return result_type(); }
+
+            void operator()(result_type& result, const argument_type& value) const {
+                if(result.empty()) {
+                    result = value;
+                } else {
+                    MADNESS_ASSERT(result.size() == value.size());
+                    for(std::size_t i = 0; i < result.size(); ++i)
+                        result[i] = op(result[i], value[i]);
+                }
+            }
+        };
+
     }  // namespace detail
 
     template <typename T>
@@ -147,6 +175,8 @@ namespace madness {
         std::shared_ptr<detail::DeferredCleanup> deferred_; ///< Deferred cleanup object.
         bool debug_; ///< Debug mode
         bool forbid_fence_=false; ///< forbid calling fence() in case of several active worlds
+        int fanout_; ///< No. of children of a process in the collective trees
+        unsigned long icollective_count_ = 0; ///< Key of the next future-based collective
 
         friend class detail::DeferredCleanup;
 
@@ -160,6 +190,13 @@ namespace madness {
         struct GroupReduceTag { };
         struct AllReduceTag { };
         struct GroupAllReduceTag { };
+        struct IReduceTag { };
+        struct IBcastTag { };
+
+        /// Computes the parent and children of this process in the collective tree with given root
+        void tree_info(const ProcessID root, ProcessID& parent, std::vector<ProcessID>& children) const {
+            world_.mpi.k_ary_tree_info(root, fanout_, parent, children);
+        }
 
 
         /// Delayed send callback object
@@ -390,15 +427,16 @@ namespace madness {
             typedef void (WorldGopInterface::*taskfnT)(const keyT&, const valueT&,
                     const ProcessID) const;
 
-            // Compute binary tree data
-            ProcessID parent = -1, child0 = -1, child1 = -1;
-            world_.mpi.binary_tree_info(root, parent, child0, child1);
+            // Compute tree data
+            ProcessID parent = -1;
+            std::vector<ProcessID> children;
+            tree_info(root, parent, children);
 
             // Set the local data, except on the root process
             if(parent != -1)
                 detail::DistCache<keyT>::set_cache_value(key, value);
 
-            if(child0 != -1) { // Check that this process has children in the binary tree
+            if(! children.empty()) { // Check that this process has children in the tree
 
                 // Get handler function and arguments
                 void (*handler)(const AmArg&) =
@@ -408,11 +446,11 @@ namespace madness {
                         key, value, root);
 
                 // Send active message to children
-                if(child1 != -1) {
-                    AmArg* const args1 = copy_am_arg(*args0);
-                    world_.am.send(child1, handler, args1);
+                for(std::size_t i = 1; i < children.size(); ++i) {
+                    AmArg* const args = copy_am_arg(*args0);
+                    world_.am.send(children[i], handler, args);
                 }
-                world_.am.send(child0, handler, args0);
+                world_.am.send(children.front(), handler, args0);
             }
         }
 
@@ -564,12 +602,20 @@ namespace madness {
             return result.get();
         }
 
+        template <typename T>
+        static T front(const std::vector<T>& v) {
+            MADNESS_ASSERT(! v.empty());
+            return v.front();
+        }
+
         /// Distributed reduce
 
         /// \tparam tagT The tag type to be added to the key type
         /// \tparam keyT The key type
         /// \tparam valueT The data type to be reduced
         /// \tparam opT The reduction operation type
+        /// \param parent The parent of this process in the tree, or -1
+        /// \param children The children of this process in the tree
         /// \param key The key associated with this reduction
         /// \param value The local value to be reduced
         /// \param op The reduction operation to be applied to local and remote data
@@ -578,26 +624,23 @@ namespace madness {
         /// uninitialized future that may be ignored.
         template <typename tagT, typename keyT, typename valueT, typename opT>
         Future<typename detail::result_of<opT>::type>
-        reduce_internal(const ProcessID parent, const ProcessID child0,
-                const ProcessID child1, const ProcessID root, const keyT& key,
-                const valueT& value, const opT& op)
+        reduce_internal(const ProcessID parent, const std::vector<ProcessID>& children,
+                const ProcessID root, const keyT& key, const valueT& value, const opT& op)
         {
             // Create tagged key
             typedef ProcessKey<keyT, tagT> key_type;
             typedef typename detail::result_of<opT>::type result_type;
             typedef typename remove_future<valueT>::type value_type;
             std::vector<Future<result_type> > results;
-            results.reserve(3);
+            results.reserve(children.size() + 1);
 
             // Add local data to vector of values to reduce
             results.push_back(world_.taskq.add(WorldGopInterface::template reduce_task<value_type, opT>,
                     value, op, TaskAttributes::hipri()));
 
             // Reduce child data
-            if(child0 != -1)
-                results.push_back(recv_internal<result_type>(key_type(key, child0)));
-            if(child1 != -1)
-                results.push_back(recv_internal<result_type>(key_type(key, child1)));
+            for(ProcessID child : children)
+                results.push_back(recv_internal<result_type>(key_type(key, child)));
 
             // Submit the local reduction task
             Future<result_type> local_result =
@@ -614,6 +657,14 @@ namespace madness {
             return Future<result_type>::default_initializer();
         }
 
+        /// Returns the children of a binary tree as given by \c Group::make_tree
+        static std::vector<ProcessID> binary_children(const ProcessID child0, const ProcessID child1) {
+            std::vector<ProcessID> children;
+            if(child0 != -1) children.push_back(child0);
+            if(child1 != -1) children.push_back(child1);
+            return children;
+        }
+
         /// Implementation of fence
 
         /// \param[in] epilogue the action to execute (by the calling thread) immediately after the fence
@@ -628,7 +679,8 @@ namespace madness {
 
         // In the World constructor can ONLY rely on MPI and MPI being initialized
         WorldGopInterface(World& world) :
-            world_(world), deferred_(new detail::DeferredCleanup()), debug_(false)
+            world_(world), deferred_(new detail::DeferredCleanup()), debug_(false),
+            fanout_(default_fanout())
         { }
 
         ~WorldGopInterface() {
@@ -644,6 +696,24 @@ namespace madness {
             return status;
         }
 
+        /// Set the fan-out of the collective trees and return the old value
+
+        /// The blocking collectives (\c fence, \c broadcast, \c reduce and
+        /// \c sum etc.) and the world-wide future-based ones send messages on
+        /// a tree in which each process has up to \c k children.  Wider trees
+        /// are shallower, which pays off on many processes.  The default is
+        /// given by the environment variable \c MAD_GOP_FANOUT, or 2.
+        /// \note Collective ... all processes must use the same fan-out.
+        int set_fanout(int k) {
+            MADNESS_ASSERT(k >= 2);
+            int status = fanout_;
+            fanout_ = k;
+            return status;
+        }
+
+        /// Returns the fan-out of the collective trees
+        int get_fanout() const { return fanout_; }
+
         /// Set forbid_fence flag to new value and return old value
         bool set_forbid_fence(bool value) {
             bool status = forbid_fence_;
@@ -728,33 +798,33 @@ namespace madness {
         }
 
       private:
+        /// Default fan-out of the collective trees, from \c MAD_GOP_FANOUT
+        static int default_fanout();
+
         template <typename T, class opT>
         void reduce_impl(T* buf, int nelem, opT op) {
-            SafeMPI::Request req0, req1;
-            ProcessID parent, child0, child1;
-            world_.mpi.binary_tree_info(0, parent, child0, child1);
+            ProcessID parent;
+            std::vector<ProcessID> children;
+            tree_info(0, parent, children);
             Tag gsum_tag = world_.mpi.unique_tag();
 
-            T* buf0 = new T[nelem];
-            T* buf1 = new T[nelem];
+            const std::size_t nchild = children.size();
+            std::vector<SafeMPI::Request> req(nchild);
+            T* bufs = new T[nchild*nelem];
 
-            if (child0 != -1) req0 = world_.mpi.Irecv(buf0, nelem*sizeof(T), MPI_BYTE, child0, gsum_tag);
-            if (child1 != -1) req1 = world_.mpi.Irecv(buf1, nelem*sizeof(T), MPI_BYTE, child1, gsum_tag);
+            for (std::size_t c=0; c<nchild; ++c)
+                req[c] = world_.mpi.Irecv(bufs + c*nelem, nelem*sizeof(T), MPI_BYTE, children[c], gsum_tag);
 
-            if (child0 != -1) {
-                World::await(req0);
-                for (long i=0; i<(long)nelem; ++i) buf[i] = op(buf[i],buf0[i]);
-            }
-            if (child1 != -1) {
-                World::await(req1);
-                for (long i=0; i<(long)nelem; ++i) buf[i] = op(buf[i],buf1[i]);
+            for (std::size_t c=0; c<nchild; ++c) {
+                World::await(req[c]);
+                const T* bufc = bufs + c*nelem;
+                for (long i=0; i<(long)nelem; ++i) buf[i] = op(buf[i],bufc[i]);
             }
 
-            delete [] buf0;
-            delete [] buf1;
+            delete [] bufs;
 
             if (parent != -1) {
-                req0 = world_.mpi.Isend(buf, nelem*sizeof(T), MPI_BYTE, parent, gsum_tag);
+                SafeMPI::Request req0 = world_.mpi.Isend(buf, nelem*sizeof(T), MPI_BYTE, parent, gsum_tag);
                 World::await(req0);
             }
 
@@ -855,6 +925,82 @@ namespace madness {
             min(&a, 1);
         }
 
+        /// Global reduction that returns immediately
+
+        /// Like \c reduce(buf,nelem,op) but the result is returned in a
+        /// future and the calling thread does not wait for it, so that the
+        /// reduction overlaps with other work.  The messages are sent by
+        /// tasks and active messages as for \c all_reduce.
+        /// \note Collective ... must be called in the same order on all
+        /// processes, relative to the other future-based collectives.
+        /// \param[in] buf The local data, which is copied
+        /// \param[in] nelem The number of elements
+        /// \param[in] op The binary reduction operation, such as \c WorldSumOp<T>
+        /// \return A future to the reduced data on all processes
+        template <typename T, typename opT>
+        Future< std::vector<T> > ireduce(const T* buf, std::size_t nelem, opT op) {
+            const unsigned long key = icollective_count_++;
+            const std::vector<T> value(buf, buf + nelem);
+            const detail::ElementwiseReduceOp<T, opT> reduce_op(op);
+
+            Hash<unsigned long> hasher;
+            const ProcessID root = hasher(key) % world_.size();
+            ProcessID parent = -1;
+            std::vector<ProcessID> children;
+            tree_info(root, parent, children);
+
+            Future< std::vector<T> > result =
+                    reduce_internal<IReduceTag>(parent, children, root, key, value, reduce_op);
+            if(world_.rank() != root)
+                result = Future< std::vector<T> >();
+            bcast_internal<IReduceTag>(key, result, root);
+
+            return result;
+        }
+
+        /// Global sum that returns immediately (see \c ireduce)
+        template <typename T>
+        Future< std::vector<T> > isum(const T* buf, std::size_t nelem) {
+            return ireduce(buf, nelem, WorldSumOp<T>());
+        }
+
+        /// Global sum of a scalar that returns immediately (see \c ireduce)
+        template <typename T>
+        Future<T> isum(const T& a) {
+            return world_.taskq.add(& WorldGopInterface::template front<T>,
+                    ireduce(&a, 1, WorldSumOp<T>()), TaskAttributes::hipri());
+        }
+
+        /// Global max of a scalar that returns immediately (see \c ireduce)
+        template <typename T>
+        Future<T> imax(const T& a) {
+            return world_.taskq.add(& WorldGopInterface::template front<T>,
+                    ireduce(&a, 1, WorldMaxOp<T>()), TaskAttributes::hipri());
+        }
+
+        /// Global min of a scalar that returns immediately (see \c ireduce)
+        template <typename T>
+        Future<T> imin(const T& a) {
+            return world_.taskq.add(& WorldGopInterface::template front<T>,
+                    ireduce(&a, 1, WorldMinOp<T>()), TaskAttributes::hipri());
+        }
+
+        /// Broadcast of a serializable object that returns immediately
+
+        /// \note Collective ... must be called in the same order on all
+        /// processes, relative to the other future-based collectives.
+        /// \param[in] obj The object to broadcast, only used on process \c root
+        /// \param[in] root The process that owns the object
+        /// \return A future to the object on all processes
+        template <typename T>
+        Future<T> ibroadcast(const T& obj, ProcessID root) {
+            MADNESS_ASSERT((root >= 0) && (root < world_.size()));
+            const unsigned long key = icollective_count_++;
+            Future<T> result = (world_.rank() == root ? Future<T>(obj) : Future<T>());
+            bcast_internal<IBcastTag>(key, result, root);
+            return result;
+        }
+
         /// Concatenate an STL vector of serializable stuff onto node 0
 
         /// \param[in] v input vector
@@ -1128,11 +1274,12 @@ namespace madness {
         reduce(const keyT& key, const valueT& value, const opT& op, const ProcessID root) {
             MADNESS_ASSERT((root >= 0) && (root < world_.size()));
 
-            // Get the binary tree data
-            ProcessID parent = -1, child0 = -1, child1 = -1;
-            world_.mpi.binary_tree_info(root, parent, child0, child1);
+            // Get the tree data
+            ProcessID parent = -1;
+            std::vector<ProcessID> children;
+            tree_info(root, parent, children);
 
-            return reduce_internal<ReduceTag>(parent, child0, child1, root, key,
+            return reduce_internal<ReduceTag>(parent, children, root, key,
                     value, op);
         }
 
@@ -1192,8 +1339,8 @@ namespace madness {
             ProcessID parent = -1, child0 = -1, child1 = -1;
             group.make_tree(group_root, parent, child0, child1);
 
-            return reduce_internal<ReduceTag>(parent, child0, child1, group_root,
-                    key, value, op);
+            return reduce_internal<ReduceTag>(parent, binary_children(child0, child1),
+                    group_root, key, value, op);
         }
 
         /// Distributed all reduce
@@ -1233,15 +1380,16 @@ namespace madness {
         template <typename keyT, typename valueT, typename opT>
         Future<typename detail::result_of<opT>::type>
         all_reduce(const keyT& key, const valueT& value, const opT& op) {
-            // Compute the parent and child processes of this process in a binary tree.
+            // Compute the parent and child processes of this process in the tree.
             Hash<keyT> hasher;
             const ProcessID root = hasher(key) % world_.size();
-            ProcessID parent = -1, child0 = -1, child1 = -1;
-            world_.mpi.binary_tree_info(root, parent, child0, child1);
+            ProcessID parent = -1;
+            std::vector<ProcessID> children;
+            tree_info(root, parent, children);
 
             // Reduce the data
             Future<typename detail::result_of<opT>::type> reduce_result =
-                    reduce_internal<AllReduceTag>(parent, child0, child1, root,
+                    reduce_internal<AllReduceTag>(parent, children, root,
                             key, value, op);
 
             if(world_.rank() != root)
@@ -1307,8 +1455,8 @@ namespace madness {
 
             // Reduce the data
             Future<typename detail::result_of<opT>::type> reduce_result =
-                    reduce_internal<GroupAllReduceTag>(parent, child0, child1,
-                            group_root, key, value, op);
+                    reduce_internal<GroupAllReduceTag>(parent,
+                            binary_children(child0, child1), group_root, key, value, op);
 
 
             if(group.rank() != group_root)
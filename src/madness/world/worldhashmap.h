@@ -48,13 +48,12 @@
 #include <madness/world/worldhash.h>
 #include <new>
 #include <stdio.h>
+#include <stdint.h>
 #include <map>
 
 namespace madness {
 
-    template <class keyT, class valueT, class hashT> class ConcurrentHashMap;
-
-    template <class keyT, class valueT, class hashfunT>
+    template <class keyT, class valueT, class hashfunT, class binT>
     class ConcurrentHashMap;
 
     namespace Hash_private {
@@ -62,6 +61,12 @@ namespace madness {
         // A hashtable is an array of nbin bins.
         // Each bin is a linked list of entries protected by a spinlock.
         // Each entry holds a key+value pair, a read-write mutex, and a link to the next entry.
+        //
+        // An indexed bin additionally keeps an open-addressed index of its
+        // entries that grows with the bin, so lookups stay O(1) no matter
+        // how many entries end up in a bin.  Entries themselves never move,
+        // so accessors, iterators and references remain valid while the
+        // index is resized.
 
         template <typename keyT, typename valueT>
         class entry : public madness::MutexReaderWriter {
@@ -70,9 +75,10 @@ namespace madness {
             datumT datum;
 
             class entry<keyT,valueT> * volatile next;
+            class entry<keyT,valueT> * volatile prev; // Only maintained by indexed_bin
 
             entry(const datumT& datum, entry<keyT,valueT>* next)
-                    : datum(datum), next(next) {}
+                    : datum(datum), next(next), prev(0) {}
         };
 
         template <class keyT, class valueT>
@@ -105,7 +111,7 @@ namespace madness {
                 unlock();           // END CRITICAL SECTION
             }
 
-            entryT* find(const keyT& key, const int lockmode) const {
+            entryT* find(const keyT& key, hashT /*hash*/, const int lockmode) const {
                 bool gotlock;
                 entryT* result;
                 madness::MutexWaiter waiter;
@@ -126,7 +132,7 @@ namespace madness {
                 return result;
             }
 
-            std::pair<entryT*,bool> insert(const datumT& datum, int lockmode) {
+            std::pair<entryT*,bool> insert(const datumT& datum, hashT /*hash*/, int lockmode) {
                 bool gotlock;
                 entryT* result;
                 bool notfound;
@@ -148,7 +154,7 @@ namespace madness {
                 return std::pair<entryT*,bool>(result,notfound);
             }
 
-            bool del(const keyT& key, int lockmode) {
+            bool del(const keyT& key, hashT /*hash*/, int lockmode) {
                 bool status = false;
                 lock();             // BEGIN CRITICAL SECTION
                 for (entryT *t=p,*prev=0; t; prev=t,t=t->next) {
@@ -184,6 +190,177 @@ namespace madness {
 
         };
 
+        template <class keyT, class valueT>
+        class indexed_bin : private madness::Spinlock {
+        private:
+            typedef entry<keyT,valueT> entryT;
+            typedef std::pair<const keyT, valueT> datumT;
+
+            struct slot {
+                hashT hash;         // Full hash of the key (saves rehashing and most key compares)
+                entryT* e;          // Zero means the slot is empty
+            };
+
+            slot* index;            // Linear-probing index of the entries in the list
+            unsigned int mask;      // Capacity of index minus one (capacity is a power of two)
+
+        public:
+
+            entryT* volatile p;     // List of entries (used for iteration)
+            int volatile ninbin;
+
+            indexed_bin() : index(0), mask(0), p(0), ninbin(0) {}
+
+            ~indexed_bin() {
+                clear();
+            }
+
+            void clear() {
+                lock();             // BEGIN CRITICAL SECTION
+                while (p) {
+                    entryT* n=p->next;
+                    delete p;
+                    p=n;
+                    ninbin--;
+                }
+                MADNESS_ASSERT(ninbin == 0);
+                delete [] index;
+                index = 0;
+                mask = 0;
+                unlock();           // END CRITICAL SECTION
+            }
+
+            entryT* find(const keyT& key, hashT hash, const int lockmode) const {
+                bool gotlock;
+                entryT* result;
+                madness::MutexWaiter waiter;
+                do {
+                    lock();             // BEGIN CRITICAL SECTION
+                    const long i = locate(key, hash);
+                    result = (i < 0) ? 0 : index[i].e;
+                    if (result) {
+                        gotlock = result->try_lock(lockmode);
+                    }
+                    else {
+                        gotlock = true;
+                    }
+                    unlock();           // END CRITICAL SECTION
+                    if (!gotlock) waiter.wait(); //cpu_relax();
+                }
+                while (!gotlock);
+
+                return result;
+            }
+
+            std::pair<entryT*,bool> insert(const datumT& datum, hashT hash, int lockmode) {
+                bool gotlock;
+                entryT* result;
+                bool notfound;
+                madness::MutexWaiter waiter;
+                do {
+                    lock();             // BEGIN CRITICAL SECTION
+                    const long i = locate(datum.first, hash);
+                    notfound = (i < 0);
+                    if (notfound) {
+                        if (!index || 4*(unsigned(ninbin)+1) > 3*(mask+1)) grow();
+                        result = new entryT(datum,p);
+                        if (p) p->prev = result;
+                        p = result;
+                        ++ninbin;
+                        place(hash, result);
+                    }
+                    else {
+                        result = index[i].e;
+                    }
+                    gotlock = result->try_lock(lockmode);
+                    unlock();           // END CRITICAL SECTION
+                    if (!gotlock) waiter.wait(); //cpu_relax();
+                }
+                while (!gotlock);
+
+                return std::pair<entryT*,bool>(result,notfound);
+            }
+
+            bool del(const keyT& key, hashT hash, int lockmode) {
+                bool status = false;
+                lock();             // BEGIN CRITICAL SECTION
+                const long i = locate(key, hash);
+                if (i >= 0) {
+                    entryT* t = index[i].e;
+                    remove_slot(i);
+                    if (t->prev) {
+                        t->prev->next = t->next;
+                    }
+                    else {
+                        p = t->next;
+                    }
+                    if (t->next) t->next->prev = t->prev;
+                    t->unlock(lockmode);
+                    delete t;
+                    --ninbin;
+                    status = true;
+                }
+                unlock();           // END CRITICAL SECTION
+                return status;
+            }
+
+            std::size_t size() const {
+                return ninbin;
+            };
+
+        private:
+            // Preferred slot ... the low bits of hash already chose the bin
+            // so mix them all into the high bits and take those
+            unsigned int home(hashT hash) const {
+                return unsigned((uint64_t(hash)*0x9E3779B97F4A7C15ull) >> 32) & mask;
+            }
+
+            long locate(const keyT& key, hashT hash) const {
+                if (!index) return -1;
+                for (unsigned int i=home(hash); index[i].e; i=(i+1)&mask) {
+                    if (index[i].hash == hash && index[i].e->datum.first == key) return i;
+                }
+                return -1;
+            }
+
+            void place(hashT hash, entryT* e) {
+                unsigned int i = home(hash);
+                while (index[i].e) i = (i+1)&mask;
+                index[i].hash = hash;
+                index[i].e = e;
+            }
+
+            // Double the capacity of the index (entries do not move)
+            void grow() {
+                const unsigned int oldcap = index ? mask+1 : 0;
+                slot* old = index;
+                const unsigned int newcap = oldcap ? 2*oldcap : 8;
+                index = new slot[newcap];
+                mask = newcap - 1;
+                for (unsigned int i=0; i<newcap; ++i) index[i].e = 0;
+                for (unsigned int i=0; i<oldcap; ++i) {
+                    if (old[i].e) place(old[i].hash, old[i].e);
+                }
+                delete [] old;
+            }
+
+            // Backward-shift deletion keeps probe sequences intact without tombstones
+            void remove_slot(unsigned int i) {
+                unsigned int j = i;
+                while (true) {
+                    index[i].e = 0;
+                    unsigned int k;
+                    do {
+                        j = (j+1)&mask;
+                        if (!index[j].e) return;
+                        k = home(index[j].hash);
+                    } while ((i <= j) ? (i < k && k <= j) : (i < k || k <= j));
+                    index[i] = index[j];
+                    i = j;
+                }
+            }
+        };
+
         /// iterator for hash
         template <class hashT> class HashIterator {
         public:
@@ -328,7 +505,7 @@ namespace madness {
 
         template <class hashT, int lockmode>
         class HashAccessor : private NO_DEFAULTS {
-            template <class a,class b,class c> friend class madness::ConcurrentHashMap;
+            template <class a,class b,class c,class d> friend class madness::ConcurrentHashMap;
         public:
             typedef typename std::conditional<std::is_const<hashT>::value,
                     typename std::add_const<typename hashT::entryT>::type,
@@ -392,13 +569,21 @@ namespace madness {
 
     } // End of namespace Hash_private
 
-    template < class keyT, class valueT, class hashfunT = Hash<keyT> >
+    /// A concurrent hash map with a TBB-like accessor API
+
+    /// The number of bins is fixed at construction; each bin has its own
+    /// lock.  The default \c Hash_private::indexed_bin grows an
+    /// open-addressed index as entries are added, so tables that end up
+    /// far larger than the estimate given to the constructor keep O(1)
+    /// lookups.  \c Hash_private::bin is the original bin that is just a
+    /// linked list; it is kept for comparison.
+    template < class keyT, class valueT, class hashfunT = Hash<keyT>,
+               class binT = Hash_private::indexed_bin<keyT,valueT> >
     class ConcurrentHashMap {
     public:
-        typedef ConcurrentHashMap<keyT,valueT,hashfunT> hashT;
+        typedef ConcurrentHashMap<keyT,valueT,hashfunT,binT> hashT;
         typedef std::pair<const keyT,valueT> datumT;
         typedef Hash_private::entry<keyT,valueT> entryT;
-        typedef Hash_private::bin<keyT,valueT> binT;
         typedef Hash_private::HashIterator<hashT> iterator;
         typedef Hash_private::HashIterator<const hashT> const_iterator;
         typedef Hash_private::HashAccessor<hashT,entryT::WRITELOCK> accessor;
@@ -432,8 +617,8 @@ namespace madness {
             return primes[nprimes-1];
         }
 
-        unsigned int hash_to_bin(const keyT& key) const {
-            return hashfun(key)%nbins;
+        unsigned int hash_to_bin(madness::hashT hash) const {
+            return hash%nbins;
         }
 
     public:
@@ -465,16 +650,18 @@ namespace madness {
         }
 
         std::pair<iterator,bool> insert(const datumT& datum) {
-            int bin = hash_to_bin(datum.first);
-            std::pair<entryT*,bool> result = bins[bin].insert(datum,entryT::NOLOCK);
+            const madness::hashT hash = hashfun(datum.first);
+            int bin = hash_to_bin(hash);
+            std::pair<entryT*,bool> result = bins[bin].insert(datum,hash,entryT::NOLOCK);
             return std::pair<iterator,bool>(iterator(this,bin,result.first),result.second);
         }
 
         /// Returns true if new pair was inserted; false if key is already in the map and the datum was not inserted
         bool insert(accessor& result, const datumT& datum) {
             result.release();
-            int bin = hash_to_bin(datum.first);
-            std::pair<entryT*,bool> r = bins[bin].insert(datum,entryT::WRITELOCK);
+            const madness::hashT hash = hashfun(datum.first);
+            int bin = hash_to_bin(hash);
+            std::pair<entryT*,bool> r = bins[bin].insert(datum,hash,entryT::WRITELOCK);
             result.set(r.first);
             return r.second;
         }
@@ -482,8 +669,9 @@ namespace madness {
         /// Returns true if new pair was inserted; false if key is already in the map and the datum was not inserted
         bool insert(const_accessor& result, const datumT& datum) {
             result.release();
-            int bin = hash_to_bin(datum.first);
-            std::pair<entryT*,bool> r = bins[bin].insert(datum,entryT::READLOCK);
+            const madness::hashT hash = hashfun(datum.first);
+            int bin = hash_to_bin(hash);
+            std::pair<entryT*,bool> r = bins[bin].insert(datum,hash,entryT::READLOCK);
             result.set(r.first);
             return r.second;
         }
@@ -499,7 +687,8 @@ namespace madness {
         }
 
         std::size_t erase(const keyT& key) {
-            if (bins[hash_to_bin(key)].del(key,entryT::NOLOCK)) return 1;
+            const madness::hashT hash = hashfun(key);
+            if (bins[hash_to_bin(hash)].del(key,hash,entryT::NOLOCK)) return 1;
             else return 0;
         }
 
@@ -509,34 +698,39 @@ namespace madness {
         }
 
         void erase(accessor& item) {
-            bins[hash_to_bin(item->first)].del(item->first,entryT::WRITELOCK);
+            const madness::hashT hash = hashfun(item->first);
+            bins[hash_to_bin(hash)].del(item->first,hash,entryT::WRITELOCK);
             item.unset();
         }
 
         void erase(const_accessor& item) {
             item.convert_read_lock_to_write_lock();
-            bins[hash_to_bin(item->first)].del(item->first,entryT::WRITELOCK);
+            const madness::hashT hash = hashfun(item->first);
+            bins[hash_to_bin(hash)].del(item->first,hash,entryT::WRITELOCK);
             item.unset();
         }
 
         iterator find(const keyT& key) {
-            int bin = hash_to_bin(key);
-            entryT* entry = bins[bin].find(key,entryT::NOLOCK);
+            const madness::hashT hash = hashfun(key);
+            int bin = hash_to_bin(hash);
+            entryT* entry = bins[bin].find(key,hash,entryT::NOLOCK);
             if (!entry) return end();
             else return iterator(this,bin,entry);
         }
 
         const_iterator find(const keyT& key) const {
-            int bin = hash_to_bin(key);
-            const entryT* entry = bins[bin].find(key,entryT::NOLOCK);
+            const madness::hashT hash = hashfun(key);
+            int bin = hash_to_bin(hash);
+            const entryT* entry = bins[bin].find(key,hash,entryT::NOLOCK);
             if (!entry) return end();
             else return const_iterator(this,bin,entry);
         }
 
         bool find(accessor& result, const keyT& key) {
             result.release();
-            int bin = hash_to_bin(key);
-            entryT* entry = bins[bin].find(key,entryT::WRITELOCK);
+            const madness::hashT hash = hashfun(key);
+            int bin = hash_to_bin(hash);
+            entryT* entry = bins[bin].find(key,hash,entryT::WRITELOCK);
             bool foundit = entry;
             if (foundit) result.set(entry);
             return foundit;
@@ -544,8 +738,9 @@ namespace madness {
 
         bool find(const_accessor& result, const keyT& key) const {
             result.release();
-            int bin = hash_to_bin(key);
-            entryT* entry = bins[bin].find(key,entryT::READLOCK);
+            const madness::hashT hash = hashfun(key);
+            int bin = hash_to_bin(hash);
+            entryT* entry = bins[bin].find(key,hash,entryT::READLOCK);
             bool foundit = entry;
             if (foundit) result.set(entry);
             return foundit;
@@ -33,11 +33,16 @@
 */
 
 #include <madness/world/worldmem.h>
+#include <madness/world/worldmutex.h>
+#include <madness/world/posixmem.h>
 #include <cstdlib>
 //#include <cstdio>
 #include <climits>
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
+#include <new>
+#include <vector>
 
 #include <mutex>
 
@@ -61,10 +66,227 @@
  */
 
 
-static madness::WorldMemInfo stats = {0, 0, 0, 0, 0, 0, ULONG_MAX, false};
+static madness::WorldMemInfo stats = {0, 0, 0, 0, 0, 0, ULONG_MAX, false, 0, 0, 0};
 
 namespace madness {
+
+    namespace {
+
+        // Pool size classes: class 0 holds blocks up to 64 bytes; above
+        // that each power-of-two interval (2^e,2^(e+1)] is split into four
+        // classes of size 2^e + q*2^(e-2), q=1..4.
+        const std::size_t pool_min_block = 64;
+        const int pool_nclass = 1 + 4*(23 - 6);
+
+        // Bytes of free blocks a thread caches per class before handing
+        // half of them to the global cache
+        const std::size_t pool_thread_bytes = std::size_t(1) << 21;
+
+        // Bytes of free blocks the global cache holds before freeing to the system
+        const std::size_t pool_global_bytes = std::size_t(1) << 28;
+
+        inline int pool_class(std::size_t nbyte) {
+            if (nbyte <= pool_min_block) return 0;
+            const int e = 63 - __builtin_clzl(nbyte - 1);  // 2^e < nbyte <= 2^(e+1)
+            const std::size_t quarter = std::size_t(1) << (e - 2);
+            const int q = int((nbyte - (std::size_t(1) << e) + quarter - 1)/quarter);
+            return 1 + 4*(e - 6) + (q - 1);
+        }
+
+        inline std::size_t pool_class_size(int c) {
+            if (c == 0) return pool_min_block;
+            const int e = (c - 1)/4 + 6;
+            const int q = (c - 1)%4 + 1;
+            return (std::size_t(1) << e) + q*(std::size_t(1) << (e - 2));
+        }
+
+        // Free blocks are chained through their first word
+        struct PoolList {
+            void* head;
+            std::size_t n;
+
+            PoolList() : head(0), n(0) {}
+
+            void push(void* p) {
+                *static_cast<void**>(p) = head;
+                head = p;
+                ++n;
+            }
+
+            void* pop() {
+                void* p = head;
+                head = *static_cast<void**>(p);
+                --n;
+                return p;
+            }
+        };
+
+        struct PoolCache;
+
+        struct PoolGlobal : private Spinlock {
+            PoolList lists[pool_nclass];
+            std::size_t nbyte;                  // Bytes cached in lists
+            std::vector<PoolCache*> caches;     // All live thread caches (for statistics)
+            unsigned long nalloc_retired;       // Counts from caches of exited threads
+            unsigned long nhit_retired;
+
+            PoolGlobal() : nbyte(0), nalloc_retired(0), nhit_retired(0) {}
+
+            using Spinlock::lock;
+            using Spinlock::unlock;
+        };
+
+        // Never destroyed so that blocks freed during static destruction are safe
+        PoolGlobal& pool_global() {
+            static PoolGlobal* g = new PoolGlobal;
+            return *g;
+        }
+
+        struct PoolCache {
+            PoolList lists[pool_nclass];
+            std::size_t nbyte;
+            unsigned long nalloc;
+            unsigned long nhit;
+
+            PoolCache() : nbyte(0), nalloc(0), nhit(0) {
+                PoolGlobal& g = pool_global();
+                g.lock();
+                g.caches.push_back(this);
+                g.unlock();
+            }
+
+            // Move nmove blocks of class c to the global cache
+            void spill(int c, std::size_t nmove) {
+                const std::size_t size = pool_class_size(c);
+                PoolGlobal& g = pool_global();
+                g.lock();
+                while (nmove--) {
+                    void* p = lists[c].pop();
+                    nbyte -= size;
+                    if (g.nbyte + size > pool_global_bytes) {
+                        free(p);
+                    }
+                    else {
+                        g.lists[c].push(p);
+                        g.nbyte += size;
+                    }
+                }
+                g.unlock();
+            }
+
+            // Take up to half a thread's worth of blocks of class c from the global cache
+            void refill(int c) {
+                const std::size_t size = pool_class_size(c);
+                std::size_t nwant = std::max(pool_thread_bytes/(2*size), std::size_t(1));
+                PoolGlobal& g = pool_global();
+                g.lock();
+                while (nwant-- && g.lists[c].n) {
+                    lists[c].push(g.lists[c].pop());
+                    g.nbyte -= size;
+                    nbyte += size;
+                }
+                g.unlock();
+            }
+
+            ~PoolCache() {
+                PoolGlobal& g = pool_global();
+                for (int c=0; c<pool_nclass; ++c) spill(c, lists[c].n);
+                g.lock();
+                g.nalloc_retired += nalloc;
+                g.nhit_retired += nhit;
+                for (std::size_t i=0; i<g.caches.size(); ++i) {
+                    if (g.caches[i] == this) {
+                        g.caches[i] = g.caches.back();
+                        g.caches.pop_back();
+                        break;
+                    }
+                }
+                g.unlock();
+            }
+        };
+
+        // The flag is trivially destructible so it is safe to read after
+        // the thread's cache has been destroyed
+        thread_local bool pool_cache_dead = false;
+
+        struct PoolCacheHolder {
+            PoolCache* cache;
+            PoolCacheHolder() : cache(0) {}
+            ~PoolCacheHolder() {
+                pool_cache_dead = true;
+                delete cache;
+            }
+        };
+
+        thread_local PoolCacheHolder pool_cache_holder;
+
+        inline PoolCache* pool_cache() {
+            if (pool_cache_dead) return 0;
+            PoolCache*& cache = pool_cache_holder.cache;
+            if (!cache) cache = new PoolCache;
+            return cache;
+        }
+
+        void* pool_system_allocate(std::size_t nbyte) {
+            void* p = 0;
+            if (posix_memalign(&p, pool_min_block, nbyte)) throw std::bad_alloc();
+            return p;
+        }
+
+        void update_pool_stats(WorldMemInfo& info) {
+            PoolGlobal& g = pool_global();
+            g.lock();
+            unsigned long nalloc = g.nalloc_retired;
+            unsigned long nhit = g.nhit_retired;
+            unsigned long nbyte = g.nbyte;
+            for (const PoolCache* c : g.caches) {
+                nalloc += c->nalloc;
+                nhit += c->nhit;
+                nbyte += c->nbyte;
+            }
+            g.unlock();
+            info.num_pool_allocs = nalloc;
+            info.num_pool_hits = nhit;
+            info.cur_pool_bytes = nbyte;
+        }
+
+    }  // namespace
+
+    void* pool_allocate(std::size_t nbyte) {
+        if (nbyte > pool_max_block) return pool_system_allocate(nbyte);
+        const int c = pool_class(nbyte);
+        PoolCache* cache = pool_cache();
+        if (!cache) return pool_system_allocate(pool_class_size(c));
+        ++(cache->nalloc);
+        if (cache->lists[c].n == 0) cache->refill(c);
+        if (cache->lists[c].n) {
+            ++(cache->nhit);
+            cache->nbyte -= pool_class_size(c);
+            return cache->lists[c].pop();
+        }
+        return pool_system_allocate(pool_class_size(c));
+    }
+
+    void pool_deallocate(void* p, std::size_t nbyte) {
+        if (!p) return;
+        if (nbyte > pool_max_block) {
+            free(p);
+            return;
+        }
+        const int c = pool_class(nbyte);
+        PoolCache* cache = pool_cache();
+        if (!cache) {
+            free(p);
+            return;
+        }
+        const std::size_t size = pool_class_size(c);
+        cache->lists[c].push(p);
+        cache->nbyte += size;
+        if (cache->lists[c].n*size > std::max(pool_thread_bytes, 4*size)) cache->spill(c, cache->lists[c].n/2);
+    }
+
     WorldMemInfo* world_mem_info() {
+        update_pool_stats(stats);
         return &stats;
     }
 
@@ -100,6 +322,12 @@ namespace madness {
             << cur_num_frags << " " << std::setw(12) << max_num_frags << "\n";
         std::cout << "  cur and max bytes allocated " << std::setw(12)
             << cur_num_bytes << " " << std::setw(12) << max_num_bytes << "\n";
+        if (num_pool_allocs) {
+            std::cout << "   pool allocs and cache hits " << std::setw(12)
+                << num_pool_allocs << " " << std::setw(12) << num_pool_hits << "\n";
+            std::cout << "       pool bytes held (free) " << std::setw(12)
+                << cur_pool_bytes << "\n";
+        }
     }
 
     void WorldMemInfo::reset() {
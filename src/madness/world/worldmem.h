@@ -91,6 +91,9 @@ namespace madness {
         unsigned long max_num_bytes;   ///< Lifetime maximum number of allocated bytes
         unsigned long max_mem_limit;   ///< if size+cur_num_bytes>max_mem_limit new will throw MadnessException
         bool trace;
+        unsigned long num_pool_allocs; ///< Counts blocks requested from the pool allocator
+        unsigned long num_pool_hits;   ///< Counts pool requests served from a cache (no malloc)
+        unsigned long cur_pool_bytes;  ///< Current number of free bytes cached by the pool
 
         /// Prints memory use statistics to std::cout
         void print() const;
@@ -110,8 +113,51 @@ namespace madness {
     };
 
     /// Returns pointer to internal structure
+
+    /// The pool allocator statistics are refreshed on each call.
     WorldMemInfo* world_mem_info();
 
+    /// \name Pool allocator
+    /// Size-class pool for short-lived, similarly sized blocks such as
+    /// tensor data (used by \c Tensor if configured with
+    /// \c ENABLE_TENSOR_POOL_ALLOCATOR).  Sizes are rounded up to one of
+    /// four classes per power of two (at most 25% waste).  Freed blocks
+    /// go to a per-thread cache and overflow to a global cache under a
+    /// lock, so in steady state neither the allocating nor the freeing
+    /// thread calls malloc.  Blocks are aligned to 64 bytes.  Blocks
+    /// larger than \c pool_max_block bytes bypass the pool.
+    ///@{
+
+    /// Largest block size (bytes) held by the pool
+    static const std::size_t pool_max_block = std::size_t(1) << 23;
+
+    /// Allocate a block of at least \p nbyte bytes ... throws \c std::bad_alloc on failure
+    void* pool_allocate(std::size_t nbyte);
+
+    /// Return a block obtained from \c pool_allocate(nbyte) to the pool
+    void pool_deallocate(void* p, std::size_t nbyte);
+
+    /// Minimal standard allocator drawing from the pool (e.g., for \c shared_ptr control blocks)
+    template <typename T>
+    struct PoolAllocator {
+        typedef T value_type;
+        PoolAllocator() = default;
+        template <typename U> PoolAllocator(const PoolAllocator<U>&) {}
+        T* allocate(std::size_t n) { return static_cast<T*>(pool_allocate(n*sizeof(T))); }
+        void deallocate(T* p, std::size_t n) { pool_deallocate(p, n*sizeof(T)); }
+        template <typename U> bool operator==(const PoolAllocator<U>&) const { return true; }
+        template <typename U> bool operator!=(const PoolAllocator<U>&) const { return false; }
+    };
+
+    /// Deleter returning an array of \c T to the pool
+    template <typename T>
+    struct PoolDeleter {
+        std::size_t nbyte;
+        PoolDeleter(std::size_t nbyte) : nbyte(nbyte) {}
+        void operator()(T* p) const { pool_deallocate(p, nbyte); }
+    };
+    ///@}
+
     namespace detail {
       template <typename Char> const Char* Vm_cstr();
 
@@ -36,12 +36,17 @@
 #include <madness/world/timers.h>
 #include <iostream>
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include <utility>
 #include <sstream>
 #include <list>
 #include <memory>
 #include <madness/world/safempi.h>
 #include <madness/world/archive.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
 
 namespace madness {
 
@@ -68,14 +73,16 @@ namespace madness {
 
         // Now that the server thread doing other stuff (including being
         // responsible for its own outbound messages) we have to poll.
-        int narrived = 0, iterations = 0;
+        int narrived = 0, nshm = 0, iterations = 0;
 
         MutexWaiter waiter;
         while((narrived == 0) && (iterations < 1000)) {
           narrived = SafeMPI::Request::Testsome(maxq_, recv_req.get(), ind.get(), status.get());
           if (narrived) break;
+          if (shm_ring_size_ && (nshm = shm_poll())) break;
           ++iterations;
           clear_send_req();
+          if (agg_size_) flush_stale_aggregates();
           myusleep(RMI::testsome_backoff_us);
         }
 
@@ -86,7 +93,7 @@ namespace madness {
         if (print_debug_info)
             print_error(rank, ":RMI: ", narrived, " messages just arrived\n");
 
-        if (narrived) {
+        if (narrived || nshm) {
             for (int m=0; m<narrived; ++m) {
                 const int src = status[m].Get_source();
                 const size_t len = status[m].Get_count(MPI_BYTE);
@@ -128,40 +135,11 @@ namespace madness {
                 }
             }
 
-            // Only ordered messages can end up in the queue due to
-            // out-of-order receipt or order of recv buffer processing.
+            process_queue();
 
-            // Sort queued messages by ascending recv count
-            std::sort(q.get(),q.get()+n_in_q);
-
-            // Loop thru messages ... since we have sorted only one pass
-            // is necessary and if we cannot process a message we
-            // save it at the beginning of the queue
-            int nleftover = 0;
-            for (int m=0; m<n_in_q; ++m) {
-                const int src = q[m].src;
-                if (q[m].count == recv_counters[src]) {
-                  if (print_debug_info)
-                    print_error(rank, ":RMI: queue invoking from=", src,
-                                " nbyte=", q[m].len, " func=", q[m].func,
-                                " ordered=", is_ordered(q[m].attr),
-                                " count=", q[m].count, "\n");
-
-                  ++(recv_counters[src]);
-                  q[m].func(recv_buf[q[m].i], q[m].len);
-                  post_recv_buf(q[m].i);
-                }
-                else {
-                    q[nleftover++] = q[m];
-                    if (print_debug_info)
-                      print_error(rank,
-                                  ":RMI: queue pending out of order from=", src,
-                                  " nbyte=", q[m].len, " func=", q[m].func,
-                                  " ordered=", is_ordered(q[m].attr),
-                                  " count=", q[m].count, "\n");
-                }
-            }
-            n_in_q = nleftover;
+            // Ordered messages waiting in the rings for those just
+            // processed, and vice versa
+            if (shm_ring_size_ && shm_poll()) process_queue();
 
             post_pending_huge_msg();
 
@@ -172,9 +150,50 @@ namespace madness {
             ThreadPool::instance()->flush_prebuf();
 #endif
             clear_send_req();
+            if (agg_size_) flush_stale_aggregates();
         }
     }
 
+    void RMI::RmiTask::process_queue() {
+        const bool print_debug_info = RMI::debugging;
+
+        // Only ordered messages can end up in the queue due to
+        // out-of-order receipt or order of recv buffer processing.
+        if (n_in_q == 0) return;
+
+        // Sort queued messages by ascending recv count
+        std::sort(q.get(),q.get()+n_in_q);
+
+        // Loop thru messages ... since we have sorted only one pass
+        // is necessary and if we cannot process a message we
+        // save it at the beginning of the queue
+        int nleftover = 0;
+        for (int m=0; m<n_in_q; ++m) {
+            const int src = q[m].src;
+            if (q[m].count == recv_counters[src]) {
+              if (print_debug_info)
+                print_error(rank, ":RMI: queue invoking from=", src,
+                            " nbyte=", q[m].len, " func=", q[m].func,
+                            " ordered=", is_ordered(q[m].attr),
+                            " count=", q[m].count, "\n");
+
+              ++(recv_counters[src]);
+              q[m].func(recv_buf[q[m].i], q[m].len);
+              post_recv_buf(q[m].i);
+            }
+            else {
+                q[nleftover++] = q[m];
+                if (print_debug_info)
+                  print_error(rank,
+                              ":RMI: queue pending out of order from=", src,
+                              " nbyte=", q[m].len, " func=", q[m].func,
+                              " ordered=", is_ordered(q[m].attr),
+                              " count=", q[m].count, "\n");
+            }
+        }
+        n_in_q = nleftover;
+    }
+
     void RMI::RmiTask::post_pending_huge_msg() {
         if (recv_buf[nrecv_]) return;      // Message already pending
         if (!hugeq.empty()) {
@@ -218,6 +237,9 @@ namespace madness {
         //             }
         //         }
         //for (int i=0; i<nrecv_; ++i) free(recv_buf[i]);
+        if (agg_buf) {
+            for (int p=0; p<nproc; ++p) free(agg_buf[p].buf);
+        }
     }
 
     static volatile bool rmi_task_is_running = false;
@@ -238,6 +260,15 @@ namespace madness {
             , ind()
             , q()
             , n_in_q(0)
+            , agg_size_(0)
+            , agg_delay_(50e-6)
+            , agg_buf()
+            , agg_npending(0)
+            , shm_ring_size_(0)
+            , shm_max_msg_(0)
+            , shm_base(nullptr)
+            , shm_len(0)
+            , shm_me(-1)
     {
         // Get the maximum buffer size from the MAD_BUFFER_SIZE environment
         // variable.
@@ -309,6 +340,27 @@ namespace madness {
             }
         }
 
+        // Get the capacity of the buffers aggregating small messages
+        // (MAD_AM_AGGREGATE, in bytes; default 0 = no aggregation) and
+        // the longest time a message may wait in one (MAD_AM_AGGREGATE_US)
+        const char* mad_am_aggregate = getenv("MAD_AM_AGGREGATE");
+        if (mad_am_aggregate && nproc > 1) {
+            std::stringstream ss(mad_am_aggregate);
+            long nbyte = 0;
+            ss >> nbyte;
+            if (nbyte > 0) {
+                agg_size_ = std::max(std::size_t(nbyte), std::size_t(1024));
+                agg_size_ = std::min(agg_size_, max_msg_len_);
+            }
+            const char* mad_am_aggregate_us = getenv("MAD_AM_AGGREGATE_US");
+            if (mad_am_aggregate_us) {
+                std::stringstream ss(mad_am_aggregate_us);
+                double us = 0.0;
+                if (ss >> us && us >= 0.0) agg_delay_ = us*1e-6;
+            }
+            if (agg_size_) agg_buf.reset(new aggregate_buffer[nproc]);
+        }
+
         // Allocate memory for receive buffer and requests
         recv_buf.reset(new void*[maxq_]);
         recv_req.reset(new Request[maxq_]);
@@ -331,6 +383,8 @@ namespace madness {
             }
             recv_buf[nrecv_] = 0;
         }
+
+        shm_initialize();
     }
 
 
@@ -354,6 +408,272 @@ namespace madness {
         RMI::task_ptr->post_pending_huge_msg();
     }
 
+    void RMI::RmiTask::aggregate_handler(void *buf, size_t nbyte) {
+        unsigned char* p = static_cast<unsigned char*>(buf) + HEADER_LEN;
+        unsigned char* end = static_cast<unsigned char*>(buf) + nbyte;
+        while (p < end) {
+            const std::size_t len = *reinterpret_cast<const std::size_t*>(p);
+            unsigned char* msg = p + AGG_ALIGNMENT;
+            const header* h = (const header*)(msg);
+            rmi_handlerT func = archive::to_abs_fn_ptr<rmi_handlerT>(h->func);
+            func(msg, len);
+            ++(RMI::stats.nmsg_unpacked);
+            p += agg_slot_size(len);
+        }
+    }
+
+    void RMI::RmiTask::aggregate(const void* buf, size_t nbyte, ProcessID dest, rmi_handlerT func) {
+        MADNESS_ASSERT(nbyte >= HEADER_LEN);
+        const std::size_t slot = agg_slot_size(nbyte);
+
+        aggregate_buffer& a = agg_buf[dest];
+        a.lock();
+        if (a.nbyte + slot > agg_size_) send_aggregate(a, dest);
+        if (!a.buf) {
+            if (posix_memalign((void**)(&a.buf), ALIGNMENT, agg_size_))
+                MADNESS_EXCEPTION("RMI: failed allocating aggregate buffer", 1);
+            a.nbyte = HEADER_LEN;
+        }
+        if (a.nmsg == 0) {
+            a.t0 = wall_time();
+            ++agg_npending;
+        }
+
+        unsigned char* p = a.buf + a.nbyte;
+        *reinterpret_cast<std::size_t*>(p) = nbyte;
+        unsigned char* msg = p + AGG_ALIGNMENT;
+        memcpy(msg, buf, nbyte);
+        header* h = (header*)(msg);
+        h->func = archive::to_rel_fn_ptr(func);
+        h->attr = ATTR_UNORDERED;
+        a.nbyte += slot;
+        ++a.nmsg;
+
+        if (a.nbyte + agg_slot_size(HEADER_LEN) > agg_size_) send_aggregate(a, dest);
+        a.unlock();
+    }
+
+    void RMI::RmiTask::send_aggregate(aggregate_buffer& a, ProcessID dest) {
+        if (a.nmsg == 0) return;
+        void* buf = a.buf;
+        const std::size_t nbyte = a.nbyte;
+        const std::size_t nmsg = a.nmsg;
+
+        // The buffer is ordered so that messages sent earlier by isend
+        // or in another aggregate buffer are processed first.  nmsg is
+        // cleared only after the send is posted so that a concurrent
+        // isend to dest (see RMI::isend) waits for it.
+        Request req = isend(buf, nbyte, dest, aggregate_handler, ATTR_ORDERED);
+        a.buf = nullptr;
+        a.nbyte = 0;
+        a.nmsg = 0;
+        --agg_npending;
+
+        lock();
+        ++(RMI::stats.naggregate_sent);
+        RMI::stats.nmsg_aggregated += nmsg;
+        RMI::stats.nbyte_aggregated += nbyte;
+        unlock();
+
+        agg_inflight_mutex.lock();
+        agg_inflight.emplace_back(buf, req);
+        agg_inflight_mutex.unlock();
+    }
+
+    void RMI::RmiTask::flush_aggregate(ProcessID dest) {
+        aggregate_buffer& a = agg_buf[dest];
+        if (a.nmsg == 0) return; // Racy peek ... a message added concurrently need not be sent now
+        a.lock();
+        send_aggregate(a, dest);
+        a.unlock();
+        free_aggregate_buffers();
+    }
+
+    void RMI::RmiTask::flush_stale_aggregates() {
+        if (agg_npending > 0) {
+            const double now = wall_time();
+            for (int p=0; p<nproc; ++p) {
+                aggregate_buffer& a = agg_buf[p];
+                if (a.nmsg && (now - a.t0) > agg_delay_ && a.try_lock()) {
+                    if (a.nmsg && (now - a.t0) > agg_delay_) send_aggregate(a, p);
+                    a.unlock();
+                }
+            }
+        }
+        free_aggregate_buffers();
+    }
+
+    void RMI::RmiTask::free_aggregate_buffers() {
+        if (!agg_inflight_mutex.try_lock()) return;
+        auto it = agg_inflight.begin();
+        while (it != agg_inflight.end()) {
+            if (it->second.Test()) {
+                free(it->first);
+                it = agg_inflight.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+        agg_inflight_mutex.unlock();
+    }
+
+    /// Length stored in a ring in place of a message to mark that the next one starts at the beginning
+    static const std::uint64_t SHM_WRAP = ~std::uint64_t(0);
+
+    void RMI::RmiTask::shm_initialize() {
+        // Get the size of the rings (MAD_RMI_SHM, in bytes; default 0 = no
+        // shared-memory channel) ... all processes must agree to use it
+        const char* mad_rmi_shm = getenv("MAD_RMI_SHM");
+        long nbyte = 0;
+        if (mad_rmi_shm) {
+            std::stringstream ss(mad_rmi_shm);
+            ss >> nbyte;
+        }
+        int on = (nbyte > 0 && nproc > 1), allon = 0;
+        comm.Allreduce(&on, &allon, 1, MPI_INT, MPI_MIN);
+        if (!allon) return;
+
+        std::size_t ring = std::max(std::size_t(nbyte), std::size_t(65536));
+        ring = ((ring + ALIGNMENT - 1)/ALIGNMENT)*ALIGNMENT;
+
+        SafeMPI::Intracomm node = comm.Split_type(SafeMPI::Intracomm::SHARED_SPLIT_TYPE, rank);
+        const int nlocal = node.Get_size();
+        if (nlocal == 1) return;
+
+        std::vector<int> local(nlocal), ranks(nlocal);
+        for (int i=0; i<nlocal; ++i) local[i] = i;
+        node.Get_group().Translate_ranks(nlocal, &local[0], comm.Get_group(), &ranks[0]);
+
+        // Process 0 on the node creates the segment, the others map it by name
+        const std::size_t len = std::size_t(nlocal)*nlocal*(sizeof(shm_ring) + ring);
+        char name[64] = {0};
+        if (node.Get_rank() == 0) {
+            snprintf(name, sizeof(name), "/madness_rmi.%d.%d", int(getpid()), rank);
+            int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+            if (fd < 0) {
+                name[0] = 0;
+            }
+            else {
+                if (ftruncate(fd, len)) { // zero fills, so all rings start empty
+                    shm_unlink(name);
+                    name[0] = 0;
+                }
+                close(fd);
+            }
+        }
+        node.Bcast(name, sizeof(name), MPI_BYTE, 0);
+
+        void* p = MAP_FAILED;
+        if (name[0]) {
+            int fd = shm_open(name, O_RDWR, 0600);
+            if (fd >= 0) {
+                p = mmap(0, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                close(fd);
+            }
+        }
+        int ok = (p != MAP_FAILED), allok = 0;
+        node.Allreduce(&ok, &allok, 1, MPI_INT, MPI_MIN);
+        if (node.Get_rank() == 0 && name[0]) shm_unlink(name); // Everyone has it mapped
+        if (!allok) {
+            if (ok) munmap(p, len);
+            if (node.Get_rank() == 0)
+                print_error("!!! WARNING: MAD_RMI_SHM: failed to map shared memory, "
+                            "using MPI between processes on node of process ", rank, "\n");
+            return;
+        }
+
+        shm_base = p;
+        shm_len = len;
+        shm_me = node.Get_rank();
+        shm_ranks = ranks;
+        shm_local.assign(nproc, -1);
+        for (int i=0; i<nlocal; ++i) shm_local[ranks[i]] = i;
+        shm_ring_size_ = ring;
+        shm_max_msg_ = std::min(ring/4, max_msg_len_);
+    }
+
+    void RMI::RmiTask::shm_finalize() {
+        if (shm_base) {
+            munmap(shm_base, shm_len);
+            shm_base = nullptr;
+            shm_ring_size_ = 0;
+        }
+    }
+
+    bool RMI::RmiTask::shm_send(const void* buf, size_t nbyte, ProcessID dest) {
+        shm_ring* r = shm_ring_ptr(shm_me, shm_local[dest]);
+        unsigned char* data = r->data();
+        const std::size_t slot = agg_slot_size(nbyte); // Same layout as in an aggregate buffer
+
+        std::uint64_t head = r->head.load(std::memory_order_relaxed);
+        const std::uint64_t tail = r->tail.load(std::memory_order_acquire);
+        std::size_t pos = head % shm_ring_size_;
+        const std::size_t skip = (pos + slot > shm_ring_size_) ? shm_ring_size_ - pos : 0;
+        if (head + skip + slot - tail > shm_ring_size_) return false;
+
+        if (skip) {
+            *reinterpret_cast<std::uint64_t*>(data + pos) = SHM_WRAP;
+            head += skip;
+            pos = 0;
+        }
+        *reinterpret_cast<std::uint64_t*>(data + pos) = nbyte;
+        memcpy(data + pos + AGG_ALIGNMENT, buf, nbyte);
+        r->head.store(head + slot, std::memory_order_release);
+        return true;
+    }
+
+    int RMI::RmiTask::shm_poll() {
+        const bool print_debug_info = RMI::debugging;
+        int n = 0;
+        for (int s=0; s<int(shm_ranks.size()); ++s) {
+            shm_ring* r = shm_ring_ptr(s, shm_me);
+            unsigned char* data = r->data();
+            const int src = shm_ranks[s];
+            std::uint64_t tail = r->tail.load(std::memory_order_relaxed);
+            const std::uint64_t head = r->head.load(std::memory_order_acquire);
+            if (tail == head) continue;
+
+            while (tail != head) {
+                const std::size_t pos = tail % shm_ring_size_;
+                const std::uint64_t len = *reinterpret_cast<const std::uint64_t*>(data + pos);
+                if (len == SHM_WRAP) {
+                    tail += shm_ring_size_ - pos;
+                    continue;
+                }
+
+                // The message is processed in place
+                unsigned char* msg = data + pos + AGG_ALIGNMENT;
+                const header* h = (const header*)(msg);
+                rmi_handlerT func = archive::to_abs_fn_ptr<rmi_handlerT>(h->func);
+                const attrT attr = h->attr;
+                const counterT count = (attr>>16);
+
+                // An ordered message must wait for earlier ones sent via
+                // MPI, and so must all messages behind it in the ring
+                if (is_ordered(attr) && count != recv_counters[src]) break;
+
+                if (print_debug_info)
+                  print_error(rank, ":RMI: shm invoking from=", src,
+                              " nbyte=", len, " func=", func,
+                              " ordered=", is_ordered(attr),
+                              " count=", count, "\n");
+
+                ++(RMI::stats.nmsg_recv);
+                ++(RMI::stats.nmsg_shm_recv);
+                RMI::stats.nbyte_recv += len;
+
+                if (is_ordered(attr)) ++(recv_counters[src]);
+                func(msg, len);
+                tail += agg_slot_size(len);
+                r->tail.store(tail, std::memory_order_release);
+                ++n;
+            }
+            r->tail.store(tail, std::memory_order_release);
+        }
+        return n;
+    }
+
     namespace detail {
     void compare_fn_addresses(void* addresses_in, void* addresses_inout,
                               int* len, MPI_Datatype* type) {
@@ -517,6 +837,22 @@ namespace madness {
         ++(RMI::stats.nmsg_sent);
         RMI::stats.nbyte_sent += nbyte;
 
+        // Messages to processes on this node go through shared memory
+        // unless the ring stays full.  Only threads other than the server
+        // wait for the receiver to make room, since the receiver may
+        // itself be waiting on us.  The lock must be held throughout so
+        // that messages enter the ring in counter order.
+        if (shm_ring_size_ && nbyte <= shm_max_msg_ && shm_local[dest] >= 0) {
+            const int ntry = RMI::get_this_thread_is_server() ? 1 : 100;
+            for (int i=0; i<ntry; ++i) {
+                if (shm_send(buf, nbyte, dest)) {
+                    ++(RMI::stats.nmsg_shm_sent);
+                    unlock();
+                    return Request();
+                }
+                myusleep(RMI::testsome_backoff_us);
+            }
+        }
 
         numsent++;
         Request result;
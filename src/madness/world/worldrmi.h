@@ -41,6 +41,9 @@
 #include <list>
 #include <memory>
 #include <tuple>
+#include <vector>
+#include <atomic>
+#include <cstdint>
 #include <pthread.h>
 #include <madness/world/print.h>
 
@@ -90,6 +93,33 @@
   void RMI::set_debug(bool)
   - to set the debug flag
 
+  If the environment variable MAD_AM_AGGREGATE is set to a positive
+  number of bytes, small messages may instead be handed to
+
+  void RMI::aggregate(const void* buf, size_t nbyte, int dest,
+                      rmi_handlerT func)
+  - copies the message into a buffer shared by all messages bound for
+  dest (the caller may immediately reuse buf); RMI::can_aggregate(nbyte)
+  tells if the message is small enough
+
+  The buffer is sent as a single ordered message once it is full, once
+  its oldest message is older than MAD_AM_AGGREGATE_US microseconds
+  (checked by the server thread), before any other message to the same
+  destination, or upon RMI::flush_aggregated().  The server thread at the
+  other end unpacks it and invokes the handlers in the order the
+  messages were added.
+
+  If the environment variable MAD_RMI_SHM is set to a ring size in
+  bytes, processes on the same node (as found by MPI_Comm_split_type)
+  map a shared-memory segment holding one single-producer ring buffer
+  for each ordered pair of them.  Messages up to a quarter of the ring
+  size are then copied into the ring of the destination instead of going
+  through MPI, and isend returns a completed request.  The server thread
+  polls its incoming rings along with the MPI receive buffers.  Ordered
+  messages carry the same counters on both paths, so a message falls
+  back to MPI when the ring is full without breaking
+  RMI::ATTR_ORDERED.
+
 */
 
 /**
@@ -132,9 +162,17 @@ namespace madness {
         uint64_t nmsg_recv;
         uint64_t nbyte_recv;
         uint64_t max_serv_send_q;
+        uint64_t naggregate_sent;   ///< No. of aggregate messages sent
+        uint64_t nmsg_aggregated;   ///< No. of messages packed into aggregate messages
+        uint64_t nbyte_aggregated;  ///< No. of bytes packed into aggregate messages
+        uint64_t nmsg_unpacked;     ///< No. of messages unpacked from received aggregate messages
+        uint64_t nmsg_shm_sent;     ///< No. of messages sent through shared memory (included in nmsg_sent)
+        uint64_t nmsg_shm_recv;     ///< No. of messages received through shared memory (included in nmsg_recv)
 
         RMIStats()
-            : nmsg_sent(0), nbyte_sent(0), nmsg_recv(0), nbyte_recv(0), max_serv_send_q(0) {}
+            : nmsg_sent(0), nbyte_sent(0), nmsg_recv(0), nbyte_recv(0), max_serv_send_q(0)
+            , naggregate_sent(0), nmsg_aggregated(0), nbyte_aggregated(0), nmsg_unpacked(0)
+            , nmsg_shm_sent(0), nmsg_shm_recv(0) {}
     };
 
     /// This for RMI server thread to manage lifetime of WorldAM messages that it is sending
@@ -221,6 +259,46 @@ namespace madness {
             std::unique_ptr<qmsg[]> q;
             int n_in_q;
 
+            /// Coalesces small messages bound for one process
+            struct aggregate_buffer : public madness::Mutex {
+                unsigned char* buf;     ///< Aligned buffer of agg_size_ bytes, or null
+                std::size_t nbyte;      ///< Bytes in use, including the RMI header
+                std::size_t nmsg;       ///< No. of messages in the buffer
+                double t0;              ///< Wall time at which the first message was added
+
+                aggregate_buffer() : buf(nullptr), nbyte(0), nmsg(0), t0(0.0) {}
+            };
+
+            static const std::size_t AGG_ALIGNMENT = 16;
+            std::size_t agg_size_;      ///< Capacity of aggregate buffers in bytes (0 = no aggregation)
+            double agg_delay_;          ///< Max. time in seconds a message waits in an aggregate buffer
+            std::unique_ptr<aggregate_buffer[]> agg_buf;
+            std::atomic<int> agg_npending; ///< No. of non-empty aggregate buffers
+            madness::Mutex agg_inflight_mutex;
+            std::list< std::pair<void*,Request> > agg_inflight; ///< Aggregate buffers being sent
+
+            /// Control block of a ring buffer in shared memory, followed by shm_ring_size_ bytes of data
+
+            /// head and tail count the bytes ever written and consumed;
+            /// only the sending process writes head and only the server
+            /// thread of the receiving process writes tail.
+            struct shm_ring {
+                std::atomic<std::uint64_t> head;
+                char pad0[ALIGNMENT - sizeof(std::atomic<std::uint64_t>)];
+                std::atomic<std::uint64_t> tail;
+                char pad1[ALIGNMENT - sizeof(std::atomic<std::uint64_t>)];
+
+                unsigned char* data() { return reinterpret_cast<unsigned char*>(this) + sizeof(shm_ring); }
+            };
+
+            std::size_t shm_ring_size_; ///< Data bytes in each ring (0 = no shared-memory channel)
+            std::size_t shm_max_msg_;   ///< Largest message sent through a ring
+            void* shm_base;             ///< Mapped shared-memory segment
+            std::size_t shm_len;        ///< Size of shm_base in bytes
+            int shm_me;                 ///< Rank of this process among those on the node
+            std::vector<int> shm_local; ///< Maps rank in comm to rank on the node, or -1 if not on the node
+            std::vector<int> shm_ranks; ///< Maps rank on the node to rank in comm
+
             static inline bool is_ordered(attrT attr) { return attr & ATTR_ORDERED; }
 
             void process_some();
@@ -276,8 +354,58 @@ namespace madness {
 
             void post_recv_buf(int i);
 
+            static void aggregate_handler(void *buf, size_t nbyte);
+
+            /// Space taken by a message of \c nbyte bytes in an aggregate buffer
+
+            /// Each message is preceded by its length and padded so that the
+            /// next one starts AGG_ALIGNMENT aligned
+            static std::size_t agg_slot_size(std::size_t nbyte) {
+                return AGG_ALIGNMENT + ((nbyte + AGG_ALIGNMENT - 1)/AGG_ALIGNMENT)*AGG_ALIGNMENT;
+            }
+
+            bool can_aggregate(size_t nbyte) const {
+                return agg_size_ && (HEADER_LEN + agg_slot_size(nbyte) <= agg_size_);
+            }
+
+            void aggregate(const void* buf, size_t nbyte, ProcessID dest, rmi_handlerT func);
+
+            /// Sends the aggregate buffer for \c dest if it holds any messages
+            void flush_aggregate(ProcessID dest);
+
+            /// Sends aggregate buffers whose oldest message has waited longer than agg_delay_
+            void flush_stale_aggregates();
+
+            /// Frees aggregate buffers whose send has completed
+            void free_aggregate_buffers();
+
+            /// Returns the ring carrying messages from node rank \c src to node rank \c dst
+            shm_ring* shm_ring_ptr(int src, int dst) const {
+                const std::size_t stride = sizeof(shm_ring) + shm_ring_size_;
+                return reinterpret_cast<shm_ring*>(static_cast<unsigned char*>(shm_base)
+                                                   + (std::size_t(src)*shm_ranks.size() + dst)*stride);
+            }
+
+            /// Maps the shared-memory segment if requested by MAD_RMI_SHM (collective on comm)
+            void shm_initialize();
+
+            /// Unmaps the shared-memory segment
+            void shm_finalize();
+
+            /// Copies a message into the ring to \c dest; assumes lock held, returns false if the ring is full
+            bool shm_send(const void* buf, size_t nbyte, ProcessID dest);
+
+            /// Invokes the handlers of messages waiting in incoming rings, returning the number invoked
+            int shm_poll();
+
+            /// Invokes queued ordered messages whose turn has come
+            void process_queue();
+
         private:
 
+            /// sends the aggregate buffer \c a for \c dest; assumes \c a is locked and not empty
+            void send_aggregate(aggregate_buffer& a, ProcessID dest);
+
             /// thread-safely round-robins through tags in [first_tag, first_tag+period) range
             /// @returns new tag to be used in messaging
             int unique_tag() const;
@@ -344,9 +472,41 @@ namespace madness {
                   "!! MADNESS RMI error: This typically occurs when an active message is sent or a remote task is spawned after calling madness::finalize()\n");
               MADNESS_EXCEPTION("!! MADNESS error: The RMI thread is not running", (task_ptr != nullptr));
             }
+            // Earlier messages to dest that are still waiting in its
+            // aggregate buffer must go first
+            if (task_ptr->agg_size_) task_ptr->flush_aggregate(dest);
             return task_ptr->isend(buf, nbyte, dest, func, attr);
         }
 
+        /// Returns true if small messages may be aggregated (see MAD_AM_AGGREGATE)
+        static bool aggregating() {
+            return task_ptr && task_ptr->agg_size_;
+        }
+
+        /// Returns true if a message of \c nbyte bytes may be aggregated
+        static bool can_aggregate(size_t nbyte) {
+            return task_ptr && task_ptr->can_aggregate(nbyte);
+        }
+
+        /// Copy a message into the aggregate buffer for its destination
+
+        /// Aggregated messages to the same destination are delivered in
+        /// order, and in order with respect to messages sent with isend.
+        /// @param[in] buf Pointer to the message, with room for the header as for isend (may be reused on return)
+        /// @param[in] nbyte Size of the message in bytes, for which can_aggregate() must be true
+        /// @param[in] dest Process to receive the message
+        /// @param[in] func The function to handle the message on the remote end
+        static void aggregate(const void* buf, size_t nbyte, ProcessID dest, rmi_handlerT func) {
+            MADNESS_ASSERT(can_aggregate(nbyte));
+            task_ptr->aggregate(buf, nbyte, dest, func);
+        }
+
+        /// Send all aggregate buffers that hold messages
+        static void flush_aggregated() {
+            if (!aggregating()) return;
+            for (int p=0; p<task_ptr->nproc; ++p) task_ptr->flush_aggregate(p);
+        }
+
         /// will complain to std::cerr and throw if ASLR is on by making
         /// sure that address of this function matches across @p comm
         /// @param[in] comm the communicator
@@ -357,6 +517,7 @@ namespace madness {
         static void end() {
             if(task_ptr) {
                 task_ptr->exit();
+                task_ptr->shm_finalize();
 #if HAVE_INTEL_TBB
                 tbb_rmi_parent_task->wait_for_all();
                 tbb::task::destroy(*tbb_rmi_parent_task);